@@ -0,0 +1,139 @@
+#include "board.h"
+#include <algorithm>
+#include "counter_rng.h"
+
+// Every cell starts out free.
+Board::Board(int grid_width, int grid_height)
+    : _gridWidth(grid_width),
+      _gridHeight(grid_height),
+      _occupied(grid_width * grid_height, 0),
+      _items(grid_width * grid_height, Item::kNone),
+      _freeSlot(grid_width * grid_height, -1),
+      _itemSlot(grid_width * grid_height, -1) {
+  _freeCells.reserve(grid_width * grid_height);
+  _itemCells.reserve(grid_width * grid_height);
+  for (int cell = 0; cell < grid_width * grid_height; cell++) {
+    AddCell(_freeCells, _freeSlot, cell);
+  }
+}
+
+void Board::Reset() {
+  std::fill(_occupied.begin(), _occupied.end(), 0);
+  std::fill(_items.begin(), _items.end(), Item::kNone);
+  std::fill(_freeSlot.begin(), _freeSlot.end(), -1);
+  std::fill(_itemSlot.begin(), _itemSlot.end(), -1);
+  _freeCells.clear();
+  _itemCells.clear();
+  _changedCells.clear();
+  for (int cell = 0; cell < _gridWidth * _gridHeight; cell++) {
+    AddCell(_freeCells, _freeSlot, cell);
+  }
+}
+
+// Appends a cell to a dense list and remembers where it went.
+void Board::AddCell(std::vector<int> &cells, std::vector<int> &slots, int cell) {
+  slots[cell] = static_cast<int>(cells.size());
+  cells.push_back(cell);
+}
+
+// Removes a cell from a dense list by moving the last entry into its slot.
+void Board::RemoveCell(std::vector<int> &cells, std::vector<int> &slots, int cell) {
+  int slot = slots[cell];
+  int last = cells.back();
+  cells[slot] = last;
+  slots[last] = slot;
+  cells.pop_back();
+  slots[cell] = -1;
+}
+
+// Brings the free list in line with a cell's snake and item layers after either has changed.
+void Board::RefreshFree(int cell) {
+  bool free = _occupied[cell] == 0 && _items[cell] == Item::kNone;
+  bool listed = _freeSlot[cell] != -1;
+  if (free && !listed) {
+    AddCell(_freeCells, _freeSlot, cell);
+  } else if (!free && listed) {
+    RemoveCell(_freeCells, _freeSlot, cell);
+  }
+}
+
+// Turning tracking on reserves enough room for any single snake move so that recording changes never allocates.  One
+// move occupies the new head cell, releases at most every body cell (the tail, plus more for a shrink power-up), takes
+// the item under the head and spawns its replacement: at most one change per cell plus three.
+void Board::TrackChanges(bool track) {
+  _trackChanges = track;
+  if (track) {
+    _changedCells.reserve(_gridWidth * _gridHeight + 3);
+  }
+}
+
+void Board::Occupy(int x, int y) {
+  int cell = Index(x, y);
+  _occupied[cell] = 1;
+  RefreshFree(cell);
+  MarkChanged(cell);
+}
+
+void Board::Release(int x, int y) {
+  int cell = Index(x, y);
+  _occupied[cell] = 0;
+  RefreshFree(cell);
+  MarkChanged(cell);
+}
+
+Board::Item Board::TakeItem(int x, int y) {
+  int cell = Index(x, y);
+  Item item = _items[cell];
+  if (item != Item::kNone) {
+    _items[cell] = Item::kNone;
+    RemoveCell(_itemCells, _itemSlot, cell);
+    RefreshFree(cell);
+    MarkChanged(cell);
+  }
+  return item;
+}
+
+bool Board::PlaceItem(int x, int y, Item item) {
+  int cell = Index(x, y);
+  if (_freeSlot[cell] == -1) {
+    return false;
+  }
+  _items[cell] = item;
+  AddCell(_itemCells, _itemSlot, cell);
+  RemoveCell(_freeCells, _freeSlot, cell);
+  MarkChanged(cell);
+  return true;
+}
+
+bool Board::SpawnItem(Item item, const std::array<std::uint32_t, 4> &draw) {
+  if (_freeCells.empty()) {
+    return false;
+  }
+  const int cellCount = _gridWidth * _gridHeight;
+  for (std::uint32_t word : {draw[0], draw[2], draw[3]}) {
+    int cell = CounterRng::UniformInt(word, cellCount);
+    if (_freeSlot[cell] != -1) {
+      return PlaceItem(cell % _gridWidth, cell / _gridWidth, item);
+    }
+  }
+  // Nearly full board: walk the cells in index order rather than the free list, whose order depends on history.
+  int rank = CounterRng::UniformInt(draw[0], static_cast<int>(_freeCells.size()));
+  for (int cell = 0; cell < cellCount; cell++) {
+    if (_freeSlot[cell] != -1 && rank-- == 0) {
+      return PlaceItem(cell % _gridWidth, cell / _gridWidth, item);
+    }
+  }
+  return false;
+}
+
+Board::Item Board::RandomPowerUp(std::uint32_t word) {
+  constexpr Item kPowerUps[] = {Item::kGrowth, Item::kSpeed, Item::kShrink};
+  return kPowerUps[CounterRng::UniformInt(word, 3)];
+}
+
+void Board::ClearItems() {
+  while (!_itemCells.empty()) {
+    int cell = _itemCells.back();
+    TakeItem(cell % _gridWidth, cell / _gridWidth);
+  }
+}
@@ -0,0 +1,81 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Per-cell state of the playing grid: which cells the snake occupies and which item, if any, lies on each cell.
+// Alongside the two layers the board keeps a dense list of free cells (neither snake nor item) and a dense list of item
+// cells, each with a reverse index so cells can be added and removed by swapping with the last entry.  That makes
+// updates O(1) regardless of board size or item count: pickup at the head is a single lookup and rendering walks only the
+// cells that actually hold items.  Spawning takes a few probes of the grid and only scans it when the board is nearly
+// full (see SpawnItem()).
+class Board {
+ public:
+  enum class Item : std::uint8_t { kNone, kFood, kGrowth, kSpeed, kShrink };
+  // Number of Item values, kNone included, for tables indexed by Item.  A new kind goes after kShrink and raises this.
+  static constexpr int kItemKinds{5};
+  static_assert(static_cast<int>(Item::kShrink) + 1 == kItemKinds, "kItemKinds must count every Item value");
+
+  Board(int grid_width, int grid_height);
+
+  // The snake calls these as its head enters a cell and its tail leaves one.
+  void Occupy(int x, int y);
+  void Release(int x, int y);
+  bool Occupied(int x, int y) const { return _occupied[Index(x, y)] != 0; }
+
+  Item ItemAt(int x, int y) const { return _items[Index(x, y)]; }
+  // Removes and returns the item on a cell (kNone if there is none).
+  Item TakeItem(int x, int y);
+  // Places an item on a specific free cell.  Returns false if the cell is not free.
+  bool PlaceItem(int x, int y, Item item);
+  // Places an item on a free cell chosen by a counter RNG draw.  Returns false if the board has no free cells.  The cell
+  // depends only on the draw and on which cells are currently free, never on the order they were freed in: words 0, 2
+  // and 3 are mapped onto the whole grid in turn and the first one that lands on a free cell is used; if all three
+  // miss, word 0 picks the k-th free cell in index order.  Word 1 is left for the caller (e.g. RandomPowerUp()).
+  // SnakeSolver's DrawFood() follows the same rule.
+  bool SpawnItem(Item item, const std::array<std::uint32_t, 4> &draw);
+  void ClearItems();
+  // Empties both layers and rebuilds the cell lists in index order, leaving the board exactly as it was constructed.
+  void Reset();
+  // Picks one of the power-up kinds from a random word.
+  static Item RandomPowerUp(std::uint32_t word);
+
+  // Cell indices (y * width + x) of every cell holding an item, in no particular order.
+  const std::vector<int> &ItemCells() const { return _itemCells; }
+  std::size_t FreeCellCount() const { return _freeCells.size(); }
+  // When tracking is on, every cell whose snake or item layer changes is appended to ChangedCells() (possibly more than
+  // once) until ClearChanges().  Tracking is off by default so that a game nobody reads the changes from does not
+  // accumulate them.
+  void TrackChanges(bool track);
+  const std::vector<int> &ChangedCells() const { return _changedCells; }
+  void ClearChanges() { _changedCells.clear(); }
+
+  int GetWidth() const { return _gridWidth; }
+  int GetHeight() const { return _gridHeight; }
+
+ private:
+  int Index(int x, int y) const { return y * _gridWidth + x; }
+  void RefreshFree(int cell);
+  void MarkChanged(int cell) {
+    if (_trackChanges) {
+      _changedCells.push_back(cell);
+    }
+  }
+  static void AddCell(std::vector<int> &cells, std::vector<int> &slots, int cell);
+  static void RemoveCell(std::vector<int> &cells, std::vector<int> &slots, int cell);
+
+  int _gridWidth;
+  int _gridHeight;
+  std::vector<std::uint8_t> _occupied;
+  std::vector<Item> _items;
+  std::vector<int> _freeCells;
+  std::vector<int> _freeSlot;
+  std::vector<int> _itemCells;
+  std::vector<int> _itemSlot;
+  bool _trackChanges{false};
+  std::vector<int> _changedCells;
+};
+
+#endif
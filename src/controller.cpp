@@ -3,13 +3,24 @@
 #include <future>
 #include "SDL.h"
 #include "snake.h"
+#include "latency.h"
 
 void Controller::ChangeDirection(std::shared_ptr<Snake> snake, Snake::Direction input,
-                                 Snake::Direction opposite) const {
+                                 Snake::Direction opposite, Uint32 eventTimestamp) const {
   if (snake->direction != opposite || snake->size == 1) {
     // Use the mutuex when changing the snake's direction since the Game::Update() and its call tree use snake->direction in making calculations.
     std::lock_guard<std::mutex> snakeLock(snake->snakeMutex);
+    // A press in the direction the snake is already heading changes nothing on screen, so it is not timed.
+    if (snake->direction == input) {
+      return;
+    }
     snake->direction = input;
+    // Tag the change with the key press time so Game::Update() and Renderer::Render() can measure input latency.  If an
+    // earlier change is still waiting to be applied, it is replaced and counted as superseded.
+    if (snake->inputOrigin != 0) {
+      snake->supersededInputs++;
+    }
+    snake->inputOrigin = LatencyRecorder::EventOrigin(eventTimestamp);
   }
   return;
 }
@@ -21,7 +32,13 @@ void Controller::ChangeDirection(std::shared_ptr<Snake> snake, Snake::Direction
 void Controller::HandleInput( std::shared_ptr<Snake> snake,  std::promise<void> &&gameEndInputPromise, std::future<void> &&snakeDiedFuture) const {
   SDL_Event e;
 
-  while (SDL_WaitEvent(&e) && snakeDiedFuture.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+  while (SDL_WaitEvent(&e)) {
+    // The snake may have died while this thread was waiting.  The event is then meant for the new game prompt (a "y" or
+    // "n", or a window close), so it is put back for Controller::GetUserOkForNewGame() rather than dropped.
+    if (snakeDiedFuture.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+      SDL_PushEvent(&e);
+      break;
+    }
     if (e.type == SDL_QUIT) {
       // In this scenario the user has pushed the "x" on the game window to shut the game down.  Set the promise to indicate to the Game::Run() method
       // that the user is exiting the game and then exit this routine and thread.
@@ -32,22 +49,22 @@ void Controller::HandleInput( std::shared_ptr<Snake> snake,  std::promise<void>
       switch (e.key.keysym.sym) {
         case SDLK_UP:
           ChangeDirection(snake, Snake::Direction::kUp,
-                          Snake::Direction::kDown);
+                          Snake::Direction::kDown, e.key.timestamp);
           break;
 
         case SDLK_DOWN:
           ChangeDirection(snake, Snake::Direction::kDown,
-                          Snake::Direction::kUp);
+                          Snake::Direction::kUp, e.key.timestamp);
           break;
 
         case SDLK_LEFT:
           ChangeDirection(snake, Snake::Direction::kLeft,
-                          Snake::Direction::kRight);
+                          Snake::Direction::kRight, e.key.timestamp);
           break;
 
         case SDLK_RIGHT:
           ChangeDirection(snake, Snake::Direction::kRight,
-                          Snake::Direction::kLeft);
+                          Snake::Direction::kLeft, e.key.timestamp);
           break;
       } 
     }
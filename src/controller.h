@@ -11,7 +11,7 @@ class Controller {
 
  private:
   void ChangeDirection(std::shared_ptr<Snake> snake, Snake::Direction input,
-                       Snake::Direction opposite) const;
+                       Snake::Direction opposite, Uint32 eventTimestamp) const;
 
 };
 
@@ -0,0 +1,74 @@
+#ifndef COUNTER_RNG_H
+#define COUNTER_RNG_H
+
+#include <array>
+#include <cstdint>
+
+// Counter-based random number generator (Philox4x32-10, Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+// There is no evolving state: draw number i of stream s under seed k is the pure function Philox(k, {i, s}).  A
+// generator is therefore 16 bytes, any draw can be produced without replaying earlier ones, and games keyed with
+// different stream ids get independent sequences that can be generated on any thread in any order.
+class CounterRng {
+ public:
+  CounterRng(std::uint64_t globalSeed, std::uint64_t streamId)
+      : _key{static_cast<std::uint32_t>(globalSeed), static_cast<std::uint32_t>(globalSeed >> 32)},
+        _stream{static_cast<std::uint32_t>(streamId), static_cast<std::uint32_t>(streamId >> 32)} {}
+
+  // Returns the four 32-bit words of draw number drawIndex.
+  std::array<std::uint32_t, 4> Block(std::uint64_t drawIndex) const {
+    std::array<std::uint32_t, 4> ctr{static_cast<std::uint32_t>(drawIndex), static_cast<std::uint32_t>(drawIndex >> 32),
+                                     _stream[0], _stream[1]};
+    std::uint32_t k0 = _key[0];
+    std::uint32_t k1 = _key[1];
+    for (int round = 0; round < 10; round++) {
+      std::uint64_t p0 = static_cast<std::uint64_t>(kMultiplier0) * ctr[0];
+      std::uint64_t p1 = static_cast<std::uint64_t>(kMultiplier1) * ctr[2];
+      ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ k0, static_cast<std::uint32_t>(p1),
+             static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ k1, static_cast<std::uint32_t>(p0)};
+      k0 += kWeyl0;
+      k1 += kWeyl1;
+    }
+    return ctr;
+  }
+
+  // Checks the round function against the Philox4x32-10 known-answer vectors published with Random123.
+  static bool SelfTest() {
+    struct KnownAnswer {
+      std::uint64_t key;
+      std::uint64_t counterLow;
+      std::uint64_t counterHigh;
+      std::array<std::uint32_t, 4> expected;
+    };
+    const KnownAnswer kKnownAnswers[] = {
+        {0, 0, 0, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {0x299f31d0a4093822ULL, 0x85a308d3243f6a88ULL, 0x0370734413198a2eULL,
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+    };
+    for (const KnownAnswer &answer : kKnownAnswers) {
+      // The low counter words are the draw index and the high words the stream id.
+      if (CounterRng(answer.key, answer.counterHigh).Block(answer.counterLow) != answer.expected) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Maps a random word onto [0, n) with a multiply and shift.  The bias is below n / 2^32, which is negligible for grid
+  // sized ranges.
+  static int UniformInt(std::uint32_t word, int n) {
+    return static_cast<int>((static_cast<std::uint64_t>(word) * static_cast<std::uint32_t>(n)) >> 32);
+  }
+
+ private:
+  static constexpr std::uint32_t kMultiplier0{0xD2511F53};
+  static constexpr std::uint32_t kMultiplier1{0xCD9E8D57};
+  static constexpr std::uint32_t kWeyl0{0x9E3779B9};
+  static constexpr std::uint32_t kWeyl1{0xBB67AE85};
+
+  std::uint32_t _key[2];
+  std::uint32_t _stream[2];
+};
+
+#endif
@@ -11,11 +11,11 @@ int Disk::readHighScore() {
     std::ifstream highScoreFile;
     // Attempt to open the high score file.  If it does not exist, create it and write "0" to it.  Otherwise,
     // read the value from the file and return it to the user.
-    highScoreFile.open(*Disk::_highScoreFileLocation);
+    highScoreFile.open(Disk::_highScoreFileLocation);
     if (!highScoreFile) {
         // The high score file does not exist.  Create one, write "0" to it, close the file, and return 0.
         std::ofstream highScoreWriteFile;
-        highScoreWriteFile.open(*Disk::_highScoreFileLocation);
+        highScoreWriteFile.open(Disk::_highScoreFileLocation);
         highScoreWriteFile << "0";
         highScoreWriteFile.close();
         return 0;
@@ -36,7 +36,7 @@ int Disk::readHighScore() {
 void Disk::writeHighScore ( int highScore ) {
     std::ofstream highScoreFile;
 
-    highScoreFile.open(*Disk::_highScoreFileLocation);
+    highScoreFile.open(Disk::_highScoreFileLocation);
     highScoreFile << highScore;
     highScoreFile.close();
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "counter_rng.h"
+#include "snake_env.h"
+
+// Throughput benchmark for SnakeEnv.  Steps a batch of games with random actions, resetting games as they finish, and
+// reports environment steps per second.  With --verify every step's incrementally updated observations are compared
+// against a full re-encode, and afterwards the used environment is reset next to a fresh one with the same seeds and
+// both are stepped with the same actions to check that a reset leaves nothing behind.
+//
+// Usage: EnvBench [--batch N] [--grid N] [--steps N] [--food N] [--power-ups N] [--verify]
+
+namespace {
+
+// Resets a used environment and a fresh one with the same seeds, steps both with the same actions and reports the first
+// step (0 for the reset itself) whose observations, rewards or dones differ, or -1 if none do.
+int CompareWithFresh(SnakeEnv &used, std::size_t batch, int grid, std::size_t food, std::size_t powerUps, int steps) {
+  SnakeEnv fresh(batch, grid, grid, food, powerUps);
+  std::vector<std::uint64_t> seeds(batch);
+  for (std::size_t game = 0; game < batch; game++) {
+    seeds[game] = 1000 + game;
+  }
+  std::vector<std::uint8_t> usedObservations(batch * used.ObservationSize());
+  std::vector<std::uint8_t> freshObservations(batch * fresh.ObservationSize());
+  std::vector<std::uint8_t> actions(batch);
+  std::vector<float> usedRewards(batch), freshRewards(batch);
+  std::vector<std::uint8_t> usedDones(batch), freshDones(batch);
+  used.Reset(seeds.data(), usedObservations.data());
+  fresh.Reset(seeds.data(), freshObservations.data());
+  if (usedObservations != freshObservations) {
+    return 0;
+  }
+
+  CounterRng actionRng(5, 0);
+  std::uint64_t actionDraw = 0;
+  for (int step = 1; step <= steps; step++) {
+    for (std::size_t game = 0; game < batch; game++) {
+      actions[game] = static_cast<std::uint8_t>(CounterRng::UniformInt(actionRng.Block(actionDraw++)[0], 4));
+    }
+    used.Step(actions.data(), usedObservations.data(), usedRewards.data(), usedDones.data());
+    fresh.Step(actions.data(), freshObservations.data(), freshRewards.data(), freshDones.data());
+    if (usedObservations != freshObservations || usedRewards != freshRewards || usedDones != freshDones) {
+      return step;
+    }
+  }
+  return -1;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::size_t batch = 256;
+  int grid = 16;
+  int steps = 10000;
+  std::size_t food = 1;
+  std::size_t powerUps = 0;
+  bool verify = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+      batch = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--grid") == 0 && i + 1 < argc) {
+      grid = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+      steps = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--food") == 0 && i + 1 < argc) {
+      food = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--power-ups") == 0 && i + 1 < argc) {
+      powerUps = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--verify") == 0) {
+      verify = true;
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--batch N] [--grid N] [--steps N] [--food N] [--power-ups N] [--verify]\n";
+      return 2;
+    }
+  }
+
+  SnakeEnv env(batch, grid, grid, food, powerUps);
+  std::vector<std::uint64_t> seeds(batch);
+  for (std::size_t game = 0; game < batch; game++) {
+    seeds[game] = game + 1;
+  }
+  std::vector<std::uint8_t> observations(batch * env.ObservationSize());
+  std::vector<std::uint8_t> reference(batch * env.ObservationSize());
+  std::vector<std::uint8_t> actions(batch);
+  std::vector<float> rewards(batch);
+  std::vector<std::uint8_t> dones(batch);
+  env.Reset(seeds.data(), observations.data());
+
+  CounterRng actionRng(3, 0);
+  std::uint64_t actionDraw = 0;
+  std::uint64_t episodes = 0;
+  double totalReward = 0;
+  double seconds = 0;
+
+  for (int step = 0; step < steps; step++) {
+    for (std::size_t game = 0; game < batch; game++) {
+      actions[game] = static_cast<std::uint8_t>(CounterRng::UniformInt(actionRng.Block(actionDraw++)[0], 4));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    env.Step(actions.data(), observations.data(), rewards.data(), dones.data());
+    seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (verify) {
+      for (std::size_t game = 0; game < batch; game++) {
+        env.EncodeFull(game, reference.data());
+      }
+      if (observations != reference) {
+        std::cerr << "Incremental observations diverged from a full encode at step " << step << ".\n";
+        return 1;
+      }
+    }
+
+    for (std::size_t game = 0; game < batch; game++) {
+      totalReward += rewards[game];
+      if (dones[game]) {
+        episodes++;
+        seeds[game] += batch;
+        env.ResetOne(game, seeds[game], observations.data());
+      }
+    }
+  }
+
+  if (verify) {
+    int diverged = CompareWithFresh(env, batch, grid, food, powerUps, 500);
+    if (diverged >= 0) {
+      std::cerr << "A reset environment diverged from a fresh one with the same seeds at step " << diverged << ".\n";
+      return 1;
+    }
+  }
+
+  std::cout << "batch=" << batch << " grid=" << grid << " steps=" << steps << " episodes=" << episodes
+            << " reward=" << totalReward << "\n";
+  std::cout << "env steps/sec: " << batch * static_cast<double>(steps) / seconds << "\n";
+  return 0;
+}
@@ -4,19 +4,24 @@
 #include <thread>
 #include <memory>
 #include <chrono>
+#include <array>
 #include "SDL.h"
 
 
 
-Game::Game(std::size_t grid_width, std::size_t grid_height, Disk &&disk)
+Game::Game(std::size_t grid_width, std::size_t grid_height, Disk &&disk, std::uint64_t seed, std::uint64_t gameId,
+           std::size_t foodCount, std::size_t powerUpCount)
     : 
-      engine(dev()),
-      random_w(0, static_cast<int>(grid_width - 1)),
-      random_h(0, static_cast<int>(grid_height - 1)),
-      _disk(disk)
+      _disk(std::move(disk)),
+      _seed(seed),
+      _gameId(gameId),
+      _itemRng(seed, gameId),
+      _foodCount(foodCount),
+      _powerUpCount(powerUpCount)
       {
   _snake = std::make_shared<Snake>(grid_width, grid_height);
-  
+  _board = std::make_shared<Board>(grid_width, grid_height);
+  _snake->AttachBoard(_board.get());
 }
 
 
@@ -24,8 +29,14 @@ Game::Game(std::size_t grid_width, std::size_t grid_height, Disk &&disk)
 void Game::ResetToNewGame()
 {
   score = 0;
-  Game::PlaceFood(Game::_renderer.get());
+  _pendingInputOrigin = 0;
+  _shownInputOrigin = 0;
+  Game::_board->ClearItems();
   Game::_snake->ResetSnake();
+  _gameId++;
+  _itemRng = CounterRng(_seed, _gameId);
+  _itemDraw = 0;
+  SpawnInitialItems();
 }
 
 // This is the dispatch loop for the game.  It initiates 2 threads:  1) Controller::HandleInput() and 2) Renderer::Render(). It stays active until either the user
@@ -40,12 +51,13 @@ void Game::Run(Controller &controller, std::unique_ptr<Renderer> renderer, std::
   bool running = true;
  
   _renderer = std::move(renderer);
+  _renderer->SetLatencyRecorder(_latencyRecorder);
 
   Game::_highScore = _disk.readHighScore();
-  PlaceFood( _renderer.get() );
+  SpawnInitialItems();
 
   // Start Render in a thread.
-  std::thread renderThread = std::thread (&Renderer::Render, _renderer.get(), _snake);
+  std::thread renderThread = std::thread (&Renderer::Render, _renderer.get(), _snake, _board);
 
   do {
     // Start HandleInput in a thread.  The gameEndPromise variable is a communication mechanism to enable the Controller::HandleInput method, running in a thread,
@@ -69,8 +81,14 @@ void Game::Run(Controller &controller, std::unique_ptr<Renderer> renderer, std::
 
       frame_start = SDL_GetTicks();
 
-      // Update the game state - snake head, snake body, and food location.  Detect if snake has "eaten" food and if the snake head has collided with the snake body.
-      Update(_renderer.get());
+      // Update the game state - snake head, snake body, and items.  Detect if snake has picked up an item and if the snake head has collided with the snake body.
+      if (_tickObserver) {
+        Uint64 tick_start = SDL_GetPerformanceCounter();
+        Update();
+        _tickObserver(static_cast<double>(SDL_GetPerformanceCounter() - tick_start) * 1e6 / SDL_GetPerformanceFrequency());
+      } else {
+        Update();
+      }
       if (!_snake->alive) {
         // Signal the Controller::HandleInput thread the snake died.  This will cause the thread to terminate since there is no more need for input to guide the
         // snake movement.
@@ -83,7 +101,8 @@ void Game::Run(Controller &controller, std::unique_ptr<Renderer> renderer, std::
       // potential for this scenario, though very unlikely, can happen at any time in a heavily used system.
       std::promise<void> renderCompletePromise;
       std::future<void> renderCompleteFuture = renderCompletePromise.get_future();
-      _renderer->RegisterNewRenderRequest(&renderCompletePromise);
+      _renderer->RegisterNewRenderRequest(&renderCompletePromise, _shownInputOrigin);
+      _shownInputOrigin = 0;
       
       frame_end = SDL_GetTicks();
 
@@ -112,6 +131,10 @@ void Game::Run(Controller &controller, std::unique_ptr<Renderer> renderer, std::
     
     }
 
+    if (!_snake->alive) {
+      _gamesPlayed++;
+    }
+
     if (score > _highScore) {
       _highScore = score;
       _disk.writeHighScore(_highScore);
@@ -124,6 +147,12 @@ void Game::Run(Controller &controller, std::unique_ptr<Renderer> renderer, std::
     
     inputThread.join();
 
+    // The window may have been closed just as the snake died, after the loop above last looked.
+    if (running && gameEndInputFuture.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+      gameEndInputFuture.get();
+      running = false;
+    }
+
     if (running) {
        if (controller.GetUserOkForNewGame()) {
         // Since the user requested a new game, reset the state information (i.e,, snake head and body, food location, and score)
@@ -140,42 +169,75 @@ void Game::Run(Controller &controller, std::unique_ptr<Renderer> renderer, std::
   renderThread.join();
 }
 
-void Game::PlaceFood(Renderer *renderer) {
-  int x, y;
-  while (true) {
-    x = random_w(engine);
-    y = random_h(engine);
-    // Check that the location is not occupied by a snake item before placing
-    // food.
-    if (!_snake->SnakeCell(x, y)) {
-      renderer->SetFoodCoordinates(x, y);
-      return;
-    }
+// Places one item on a random free cell.  A single counter-based draw picks both the cell and, for power-ups, the kind.
+void Game::SpawnItem(bool powerUp) {
+  std::array<std::uint32_t, 4> draw = _itemRng.Block(_itemDraw++);
+  Board::Item item = powerUp ? Board::RandomPowerUp(draw[1]) : Board::Item::kFood;
+  _board->SpawnItem(item, draw);
+}
+
+void Game::SpawnInitialItems() {
+  for (std::size_t i = 0; i < _foodCount; i++) {
+    SpawnItem(false);
+  }
+  for (std::size_t i = 0; i < _powerUpCount; i++) {
+    SpawnItem(true);
   }
 }
 
-void Game::Update(Renderer *renderer) {
+void Game::Update() {
   if (!_snake->alive) {
     return;
   }
 
-  // Protect access to the snake and food as they are being updated so that 
+  // Protect access to the snake and items as they are being updated so that 
   // any potential real time interactions with the rendering process and input process are eliminated.
   std::lock_guard<std::mutex> snakeUpdateProtect(_snake->snakeMutex);
+  int prev_x = static_cast<int>(_snake->GetSnakeHeadX());
+  int prev_y = static_cast<int>(_snake->GetSnakeHeadY());
   _snake->Update();
 
+  // The snake has now moved using any new direction, so the input that set it has been applied.  An earlier input still
+  // waiting to be shown has been overridden and never will be.
+  if (_snake->inputOrigin != 0) {
+    if (_latencyRecorder != nullptr) {
+      _latencyRecorder->RecordApply(_snake->inputOrigin);
+      if (_pendingInputOrigin != 0) {
+        _latencyRecorder->RecordSuperseded(1);
+      }
+    }
+    _pendingInputOrigin = _snake->inputOrigin;
+    _snake->inputOrigin = 0;
+  }
+  if (_snake->supersededInputs != 0) {
+    if (_latencyRecorder != nullptr) {
+      _latencyRecorder->RecordSuperseded(_snake->supersededInputs);
+    }
+    _snake->supersededInputs = 0;
+  }
+
   int new_x = static_cast<int>(_snake->GetSnakeHeadX());
   int new_y = static_cast<int>(_snake->GetSnakeHeadY());
 
-  // Check if there's food over here
-  if (renderer->GetFoodXCoordinate() == new_x && renderer->GetFoodYCoordinate() == new_y) {
-    score++;
-    PlaceFood(renderer);
-    // Grow snake and increase speed.
-    _snake->GrowBody();
-    _snake->speed += 0.005;
+  // The head only turns on screen once it enters a new cell in the new direction, so that frame is the one to time.
+  if (_pendingInputOrigin != 0 && (new_x != prev_x || new_y != prev_y)) {
+    _shownInputOrigin = _pendingInputOrigin;
+    _pendingInputOrigin = 0;
+  }
+
+  // Check if there's an item over here.  The board lookup keeps this constant time however many items are out.
+  Board::Item item = _board->TakeItem(new_x, new_y);
+  if (item != Board::Item::kNone) {
+    score += _snake->Consume(item);
+    SpawnItem(item != Board::Item::kFood);
   }
 }
 
+// Attach a recorder to measure input->apply and input->present latency.  This must be called before Run().
+void Game::SetLatencyRecorder(LatencyRecorder *latencyRecorder) { _latencyRecorder = latencyRecorder; }
+
+// Attach an observer that is handed the duration of every Game::Update() call.  This must be called before Run().
+void Game::SetTickObserver(std::function<void(double microseconds)> tickObserver) { _tickObserver = std::move(tickObserver); }
+
 int Game::GetScore() const { return score; }
 int Game::GetSize() const { return _snake->size; }
\ No newline at end of file
@@ -1,13 +1,18 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include <random>
+#include <cstdint>
 #include <memory>
+#include <atomic>
+#include <functional>
 #include "SDL.h"
 #include "controller.h"
 #include "renderer.h"
 #include "snake.h"
 #include "disk.h"
+#include "latency.h"
+#include "counter_rng.h"
+#include "board.h"
 
 class BaseGame {
   public:
@@ -16,30 +21,51 @@ class BaseGame {
 
 class Game :  public BaseGame {
  public:
-  Game(std::size_t grid_width, std::size_t grid_height, Disk &&disk);
+  Game(std::size_t grid_width, std::size_t grid_height, Disk &&disk, std::uint64_t seed, std::uint64_t gameId = 0,
+       std::size_t foodCount = 1, std::size_t powerUpCount = 0);
   
   void Run(Controller &controller, std::unique_ptr<Renderer> renderer,  std::size_t target_frame_duration) override;
 
   int GetScore() const;
   int GetSize() const;
+  void SetLatencyRecorder(LatencyRecorder *latencyRecorder);
+  void SetTickObserver(std::function<void(double microseconds)> tickObserver);
+  int GetGamesPlayed() const { return _gamesPlayed; }
+  // Stream id of the game in progress, or of the last game once Run() has returned.
+  std::uint64_t GetGameId() const { return _gameId; }
   std::size_t foo;
 
  private:
   std::shared_ptr<Snake> _snake;
+  std::shared_ptr<Board> _board;
   std::unique_ptr<Renderer> _renderer;
   // std::unique_ptr<Disk> _disk;
   Disk _disk;
 
 
-  std::random_device dev;
-  std::mt19937 engine;
-  std::uniform_int_distribution<int> random_w;
-  std::uniform_int_distribution<int> random_h;
+  // Each item's cell is a pure function of (seed, _gameId, _itemDraw) and the cells that are free when it is drawn.  Every
+  // new game moves on to the next stream id and restarts the draw count, so any game of a session can be replayed alone.
+  std::uint64_t _seed;
+  std::uint64_t _gameId;
+  CounterRng _itemRng;
+  std::uint64_t _itemDraw{0};
+  // The number of food and power-up items kept on the board.  Each item that is picked up is replaced by one of the same kind.
+  std::size_t _foodCount;
+  std::size_t _powerUpCount;
   int _highScore;
+  LatencyRecorder *_latencyRecorder{nullptr};
+  std::function<void(double microseconds)> _tickObserver;
+  // Completed games.  Read from other threads by monitoring tools while Run() is in progress.
+  std::atomic<int> _gamesPlayed{0};
+  // Origin of an applied input whose new direction is not on screen yet, because the head has not entered a new cell.
+  Uint64 _pendingInputOrigin{0};
+  // Origin of the input the next frame shows for the first time, handed to the next render request (0 if none).
+  Uint64 _shownInputOrigin{0};
   int score{0};
 
-  void PlaceFood(Renderer * renderer);
-  void Update(Renderer * renderer);
+  void SpawnItem(bool powerUp);
+  void SpawnInitialItems();
+  void Update();
   void ResetToNewGame();
 };
 
@@ -0,0 +1,18 @@
+#include "input_injection.h"
+#include <cstring>
+
+void PushKey(SDL_Keycode key) {
+  SDL_Event e;
+  std::memset(&e, 0, sizeof(e));
+  e.type = SDL_KEYDOWN;
+  e.key.state = SDL_PRESSED;
+  e.key.keysym.sym = key;
+  SDL_PushEvent(&e);
+}
+
+void PushQuit() {
+  SDL_Event e;
+  std::memset(&e, 0, sizeof(e));
+  e.type = SDL_QUIT;
+  SDL_PushEvent(&e);
+}
@@ -0,0 +1,13 @@
+#ifndef INPUT_INJECTION_H
+#define INPUT_INJECTION_H
+
+#include "SDL.h"
+
+// Synthetic input for the tools that drive the real game loop (LatencyBench, SoakTest).  Events go through
+// SDL_PushEvent(), so Controller::HandleInput() receives them exactly like key presses from a player.  SDL stamps each
+// event with the time it was pushed.
+void PushKey(SDL_Keycode key);
+// Asks the game to shut down, as closing the window does.
+void PushQuit();
+
+#endif
@@ -0,0 +1,108 @@
+#include "latency.h"
+#include <algorithm>
+#include <iomanip>
+
+LatencyHistogram::LatencyHistogram(double bucketWidthUs, std::size_t bucketCount)
+    : _bucketWidthUs(bucketWidthUs), _buckets(bucketCount, 0) {}
+
+void LatencyHistogram::Record(double microseconds) {
+  if (microseconds < 0) {
+    microseconds = 0;
+  }
+  std::size_t bucket = static_cast<std::size_t>(microseconds / _bucketWidthUs);
+  if (bucket < _buckets.size()) {
+    _buckets[bucket]++;
+  } else {
+    _overflow++;
+  }
+  _count++;
+  _sum += microseconds;
+  _max = std::max(_max, microseconds);
+}
+
+void LatencyHistogram::Clear() {
+  std::fill(_buckets.begin(), _buckets.end(), 0);
+  _overflow = 0;
+  _count = 0;
+  _sum = 0;
+  _max = 0;
+}
+
+double LatencyHistogram::Mean() const {
+  return _count == 0 ? 0 : _sum / _count;
+}
+
+// Returns the upper edge of the bucket holding the requested percentile, so the result is accurate to one bucket width.
+// Percentiles that land in the overflow bucket report the maximum sample.
+double LatencyHistogram::Percentile(double percent) const {
+  if (_count == 0) {
+    return 0;
+  }
+  std::uint64_t rank = static_cast<std::uint64_t>(percent / 100.0 * (_count - 1)) + 1;
+  std::uint64_t seen = 0;
+  for (std::size_t i = 0; i < _buckets.size(); i++) {
+    seen += _buckets[i];
+    if (seen >= rank) {
+      return std::min((i + 1) * _bucketWidthUs, _max);
+    }
+  }
+  return _max;
+}
+
+void LatencyHistogram::Print(std::ostream &out, const std::string &name) const {
+  out << std::fixed << std::setprecision(2);
+  out << name << ": n=" << _count << " mean=" << Mean() / 1000 << "ms p50=" << Percentile(50) / 1000
+      << "ms p90=" << Percentile(90) / 1000 << "ms p99=" << Percentile(99) / 1000 << "ms max=" << _max / 1000
+      << "ms\n";
+  for (std::size_t i = 0; i < _buckets.size(); i++) {
+    if (_buckets[i] != 0) {
+      out << "  [" << i * _bucketWidthUs / 1000 << ", " << (i + 1) * _bucketWidthUs / 1000 << ") ms: " << _buckets[i]
+          << "\n";
+    }
+  }
+  if (_overflow != 0) {
+    out << "  >= " << _buckets.size() * _bucketWidthUs / 1000 << " ms: " << _overflow << "\n";
+  }
+}
+
+// Latencies are bucketed at 0.5 ms up to 250 ms, which comfortably covers several frames at 60 FPS.
+LatencyRecorder::LatencyRecorder()
+    : _counterFrequency(SDL_GetPerformanceFrequency()),
+      _inputToApply(500, 500),
+      _inputToPresent(500, 500) {}
+
+Uint64 LatencyRecorder::EventOrigin(Uint32 eventTimestamp) {
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint32 ticks = SDL_GetTicks();
+  Uint64 queuedMs = ticks > eventTimestamp ? ticks - eventTimestamp : 0;
+  return now - queuedMs * SDL_GetPerformanceFrequency() / 1000;
+}
+
+double LatencyRecorder::MicrosecondsSince(Uint64 inputOrigin) const {
+  Uint64 now = SDL_GetPerformanceCounter();
+  return static_cast<double>(now - inputOrigin) * 1e6 / _counterFrequency;
+}
+
+void LatencyRecorder::RecordApply(Uint64 inputOrigin) {
+  double latency = MicrosecondsSince(inputOrigin);
+  std::lock_guard<std::mutex> latencyGuard(_latencyMutex);
+  _inputToApply.Record(latency);
+}
+
+void LatencyRecorder::RecordPresent(Uint64 inputOrigin) {
+  double latency = MicrosecondsSince(inputOrigin);
+  std::lock_guard<std::mutex> latencyGuard(_latencyMutex);
+  _inputToPresent.Record(latency);
+}
+
+void LatencyRecorder::RecordSuperseded(std::uint32_t count) {
+  std::lock_guard<std::mutex> latencyGuard(_latencyMutex);
+  _superseded += count;
+}
+
+void LatencyRecorder::Print(std::ostream &out) {
+  std::lock_guard<std::mutex> latencyGuard(_latencyMutex);
+  _inputToApply.Print(out, "input->apply");
+  _inputToPresent.Print(out, "input->present");
+  out << "superseded before shown: " << _superseded << "\n";
+}
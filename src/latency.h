@@ -0,0 +1,64 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "SDL.h"
+
+// Fixed-width bucket histogram of latencies in microseconds.  Samples beyond the last bucket are counted in an
+// overflow bucket; the exact maximum is tracked separately so it is never lost.
+class LatencyHistogram {
+ public:
+  LatencyHistogram(double bucketWidthUs, std::size_t bucketCount);
+
+  void Record(double microseconds);
+  void Clear();
+
+  std::uint64_t Count() const { return _count; }
+  double Mean() const;
+  double Max() const { return _max; }
+  double Percentile(double percent) const;
+  void Print(std::ostream &out, const std::string &name) const;
+
+ private:
+  double _bucketWidthUs;
+  std::vector<std::uint64_t> _buckets;
+  std::uint64_t _overflow{0};
+  std::uint64_t _count{0};
+  double _sum{0};
+  double _max{0};
+};
+
+// Collects end-to-end input latencies.  Every accepted key press is tagged with its origin on the performance counter
+// clock (see EventOrigin()), and that tag is carried with the snake to the Game::Update() that first moves it in the new
+// direction (input->apply).  The head only visibly turns when it enters its next cell, so the tag is held until then and
+// sent with that frame's render request to Renderer::Render() (input->present).  Both histograms are shared by the game and render threads,
+// so they are only touched under _latencyMutex.
+class LatencyRecorder {
+ public:
+  LatencyRecorder();
+
+  // Converts an SDL event timestamp (SDL_GetTicks() milliseconds) into the performance counter clock so that the time
+  // the event spent queued is included in the measured latency.
+  static Uint64 EventOrigin(Uint32 eventTimestamp);
+
+  void RecordApply(Uint64 inputOrigin);
+  void RecordPresent(Uint64 inputOrigin);
+  // Counts inputs that were replaced by a newer direction change before they were shown.
+  void RecordSuperseded(std::uint32_t count);
+  void Print(std::ostream &out);
+
+ private:
+  double MicrosecondsSince(Uint64 inputOrigin) const;
+
+  Uint64 _counterFrequency;
+  std::mutex _latencyMutex;
+  LatencyHistogram _inputToApply;
+  LatencyHistogram _inputToPresent;
+  std::uint64_t _superseded{0};
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "SDL.h"
+#include "controller.h"
+#include "disk.h"
+#include "game.h"
+#include "input_injection.h"
+#include "latency.h"
+#include "renderer.h"
+
+// Input latency benchmark.  Runs the real Game::Run() loop and injects arrow key presses with SDL_PushEvent() from a
+// separate thread at a fixed interval, optionally while other threads keep the CPU busy.  Every press is timed from its
+// SDL event timestamp to the Game::Update() that first moves the snake in the new direction (input->apply) and to the end
+// of SDL_RenderPresent() for the first frame in which the head has entered a cell in that direction (input->present).
+//
+// Usage: LatencyBench [--inputs N] [--interval-ms N] [--load-threads N] [--window]
+
+namespace {
+
+constexpr std::size_t kFramesPerSecond{60};
+constexpr std::size_t kMsPerFrame{1000 / kFramesPerSecond};
+constexpr std::size_t kScreenWidth{640};
+constexpr std::size_t kScreenHeight{640};
+constexpr std::size_t kGridWidth{32};
+constexpr std::size_t kGridHeight{32};
+
+// Alternates between two perpendicular directions so every press is accepted by Controller::ChangeDirection() and
+// actually changes the direction.  A "y" follows every press so that a new game is started if the snake has died;
+// Controller::HandleInput() ignores it during play.
+void InjectInput(int inputs, int intervalMs) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  for (int i = 0; i < inputs; i++) {
+    PushKey(i % 2 == 0 ? SDLK_RIGHT : SDLK_UP);
+    PushKey(SDLK_y);
+    std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+  }
+  PushQuit();
+}
+
+void BurnCpu(std::atomic<bool> *stop) {
+  volatile std::uint64_t sink = 0;
+  while (!stop->load(std::memory_order_relaxed)) {
+    for (int i = 0; i < 10000; i++) {
+      sink = sink * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  int inputs = 300;
+  int intervalMs = 50;
+  int loadThreads = 0;
+  Renderer::Mode mode = Renderer::Mode::kOffscreen;
+
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--inputs") == 0 && i + 1 < argc) {
+      inputs = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--interval-ms") == 0 && i + 1 < argc) {
+      intervalMs = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--load-threads") == 0 && i + 1 < argc) {
+      loadThreads = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--window") == 0) {
+      mode = Renderer::Mode::kWindow;
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--inputs N] [--interval-ms N] [--load-threads N] [--window]\n";
+      return 2;
+    }
+  }
+
+  std::unique_ptr<Renderer> renderer =
+      std::make_unique<Renderer>(kScreenWidth, kScreenHeight, kGridWidth, kGridHeight, mode);
+  Controller controller;
+  LatencyRecorder latencyRecorder;
+  // A fixed seed keeps the food layout, and therefore the snake's path, the same from run to run.
+  Game game(kGridWidth, kGridHeight, Disk("./LatencyBenchHighScore"), 1);
+  game.SetLatencyRecorder(&latencyRecorder);
+
+  std::atomic<bool> stopLoad{false};
+  std::vector<std::thread> loadThreadPool;
+  for (int i = 0; i < loadThreads; i++) {
+    loadThreadPool.emplace_back(BurnCpu, &stopLoad);
+  }
+
+  std::thread injectThread(InjectInput, inputs, intervalMs);
+  game.Run(controller, std::move(renderer), kMsPerFrame);
+  injectThread.join();
+
+  stopLoad = true;
+  for (std::thread &loadThread : loadThreadPool) {
+    loadThread.join();
+  }
+
+  std::cout << "inputs=" << inputs << " interval=" << intervalMs << "ms load-threads=" << loadThreads << "\n";
+  latencyRecorder.Print(std::cout);
+  return 0;
+}
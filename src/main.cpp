@@ -4,22 +4,57 @@
 #include "renderer.h"
 #include "disk.h"
 #include <memory>
+#include <random>
+#include <string>
+#include <cstdint>
+#include <exception>
 
-int main() {
+// Parses a whole argument as a non-negative number; anything else is a usage error rather than an uncaught exception.
+static bool ParseNumber(const char *text, std::uint64_t &value) {
+  std::size_t parsed = 0;
+  try {
+    value = std::stoull(text, &parsed);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return parsed != 0 && text[parsed] == '\0' && text[0] != '-';
+}
+
+// An optional seed, and optionally the id of the first game, may be passed on the command line.  Item placement depends
+// only on those, the number of items drawn so far and the free cells, so making the same moves replays a game's items.
+// Otherwise a random seed is chosen.  The seed and the id range of the games played are reported at exit.
+int main(int argc, char *argv[]) {
   constexpr std::size_t kFramesPerSecond{60};
   constexpr std::size_t kMsPerFrame{1000 / kFramesPerSecond};
   constexpr std::size_t kScreenWidth{640};
   constexpr std::size_t kScreenHeight{640};
   constexpr std::size_t kGridWidth{32};
   constexpr std::size_t kGridHeight{32};
+  constexpr std::size_t kFoodCount{1};
+  constexpr std::size_t kPowerUpCount{2};
+
+  std::uint64_t seed = 0;
+  std::uint64_t firstGameId = 0;
+  if (argc > 3 || (argc > 1 && !ParseNumber(argv[1], seed)) || (argc > 2 && !ParseNumber(argv[2], firstGameId))) {
+    std::cerr << "Usage: " << argv[0] << " [seed [game-id]]\n";
+    return 2;
+  }
+  if (argc <= 1) {
+    // random_device yields 32 bits per call, so two draws fill the 64-bit seed.
+    std::random_device dev;
+    seed = (static_cast<std::uint64_t>(dev()) << 32) | dev();
+  }
 
   std::unique_ptr<Renderer> renderer = std::make_unique<Renderer>(kScreenWidth, kScreenHeight, kGridWidth, kGridHeight);
   Controller controller;
   Disk disk = Disk("./HighScore");
-  Game game(kGridWidth, kGridHeight, std::move(disk));
+  Game game(kGridWidth, kGridHeight, std::move(disk), seed, firstGameId, kFoodCount, kPowerUpCount);
   game.Run(controller, std::move(renderer), kMsPerFrame);
   std::cout << "Game has terminated successfully!\n";
   std::cout << "Score: " << game.GetScore() << "\n";
   std::cout << "Size: " << game.GetSize() << "\n";
+  std::cout << "Seed: " << seed << "\n";
+  std::cout << "Game ids: " << firstGameId << " to " << game.GetGameId() << " (replay one with: " << argv[0] << " "
+            << seed << " <game-id>)\n";
   return 0;
 }
@@ -0,0 +1,182 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "SDL.h"
+#include "renderer.h"
+#include "snake.h"
+#include "board.h"
+
+// Offscreen render benchmark.  Renders synthetic game states as fast as possible with Renderer::Mode::kOffscreen and
+// reports frames/sec and per-frame cost for a range of grid sizes and snake lengths.  The last frame of every
+// configuration is hashed so that render changes can be checked against a file of golden hashes.
+//
+// Usage: RenderBench [--frames N] [--golden-out FILE] [--golden-check FILE]
+
+namespace {
+
+constexpr std::size_t kScreenWidth{640};
+constexpr std::size_t kScreenHeight{640};
+
+// Maps the i-th step of a serpentine walk over the grid to a cell.  Consecutive steps are always adjacent cells, so the
+// first n steps lay out a valid snake of length n that covers the board row by row.
+SDL_Point SerpentineCell(int i, int grid_width) {
+  int y = i / grid_width;
+  int x = i % grid_width;
+  if (y % 2 == 1) {
+    x = grid_width - 1 - x;
+  }
+  return SDL_Point{x, y};
+}
+
+// Lays a new snake of the requested length along the serpentine walk with the head at its end, and places a food on the
+// next cell of the walk (if the snake does not fill the board).
+void BuildState(Snake &snake, Board &board, int grid_width, int grid_height, int length) {
+  for (int i = 0; i < length - 1; i++) {
+    snake.body.push_back(SerpentineCell(i, grid_width));
+  }
+  SDL_Point head = SerpentineCell(length - 1, grid_width);
+  snake.SetSnakeHead(head.x, head.y);
+  snake.size = length;
+  snake.AttachBoard(&board);
+
+  if (length < grid_width * grid_height) {
+    SDL_Point food = SerpentineCell(length, grid_width);
+    board.PlaceItem(food.x, food.y, Board::Item::kFood);
+  }
+}
+
+using GoldenKey = std::pair<int, int>;
+
+// Reads a file written by --golden-out.  Returns false if the file cannot be opened.
+bool ReadGolden(const std::string &path, std::map<GoldenKey, std::uint64_t> &golden) {
+  std::ifstream goldenFile(path);
+  if (!goldenFile) {
+    std::cerr << "Golden file " << path << " could not be opened.\n";
+    return false;
+  }
+  std::string line;
+  while (std::getline(goldenFile, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    int grid, length;
+    std::uint64_t hash;
+    if (fields >> grid >> length >> std::hex >> hash) {
+      golden[{grid, length}] = hash;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  int frames = 2000;
+  std::string goldenOut;
+  std::string goldenCheck;
+
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--golden-out") == 0 && i + 1 < argc) {
+      goldenOut = argv[++i];
+    } else if (std::strcmp(argv[i], "--golden-check") == 0 && i + 1 < argc) {
+      goldenCheck = argv[++i];
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--frames N] [--golden-out FILE] [--golden-check FILE]\n";
+      return 2;
+    }
+  }
+  if (frames < 1) {
+    std::cerr << "--frames must be at least 1.\n";
+    return 2;
+  }
+
+  const std::vector<int> gridSizes{16, 32, 64, 128};
+  const std::vector<int> snakeLengths{1, 16, 256, 1024, 4096, 16384};
+
+  std::map<GoldenKey, std::uint64_t> golden;
+  if (!goldenCheck.empty() && !ReadGolden(goldenCheck, golden)) {
+    return 1;
+  }
+  std::ofstream goldenOutFile;
+  if (!goldenOut.empty()) {
+    goldenOutFile.open(goldenOut);
+    if (!goldenOutFile) {
+      std::cerr << "Golden file " << goldenOut << " could not be created.\n";
+      return 1;
+    }
+    goldenOutFile << "# grid length frame-hash\n";
+  }
+
+  int mismatches = 0;
+  int missing = 0;
+  std::cout << std::setw(6) << "grid" << std::setw(8) << "length" << std::setw(12) << "frames/s" << std::setw(12)
+            << "us/frame" << "  hash\n";
+
+  for (int grid : gridSizes) {
+    Renderer renderer(kScreenWidth, kScreenHeight, grid, grid, Renderer::Mode::kOffscreen);
+
+    for (int length : snakeLengths) {
+      if (length > grid * grid) {
+        continue;
+      }
+      auto snake = std::make_shared<Snake>(grid, grid);
+      auto board = std::make_shared<Board>(grid, grid);
+      BuildState(*snake, *board, grid, grid, length);
+
+      // One untimed frame so that first-use costs inside SDL are not charged to the configuration.
+      renderer.RenderFrame(snake, board);
+
+      auto start = std::chrono::steady_clock::now();
+      for (int frame = 0; frame < frames; frame++) {
+        renderer.RenderFrame(snake, board);
+      }
+      auto end = std::chrono::steady_clock::now();
+
+      double seconds = std::chrono::duration<double>(end - start).count();
+      std::uint64_t hash = renderer.FrameHash();
+
+      std::cout << std::setw(6) << grid << std::setw(8) << length << std::setw(12) << std::fixed
+                << std::setprecision(1) << frames / seconds << std::setw(12) << std::setprecision(2)
+                << seconds * 1e6 / frames << "  " << std::hex << std::setw(16) << std::setfill('0') << hash
+                << std::dec << std::setfill(' ');
+
+      if (goldenOutFile.is_open()) {
+        goldenOutFile << grid << " " << length << " " << std::hex << hash << std::dec << "\n";
+      }
+      if (!goldenCheck.empty()) {
+        auto expected = golden.find({grid, length});
+        if (expected == golden.end()) {
+          std::cout << "  (no golden)";
+          missing++;
+        } else if (expected->second != hash) {
+          std::cout << "  MISMATCH";
+          mismatches++;
+        } else {
+          std::cout << "  ok";
+        }
+      }
+      std::cout << "\n";
+    }
+  }
+
+  if (mismatches > 0) {
+    std::cerr << mismatches << " frame(s) did not match the golden hashes.\n";
+  }
+  if (missing > 0) {
+    std::cerr << missing << " frame(s) have no golden hash.\n";
+  }
+  return mismatches > 0 || missing > 0 ? 1 : 0;
+}
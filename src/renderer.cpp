@@ -7,12 +7,36 @@
 
 Renderer::Renderer(const std::size_t screen_width,
                    const std::size_t screen_height,
-                   const std::size_t grid_width, const std::size_t grid_height)
+                   const std::size_t grid_width, const std::size_t grid_height,
+                   Mode mode)
     : screen_width(screen_width),
       screen_height(screen_height),
       grid_width(grid_width),
       grid_height(grid_height) {
   
+  if (mode == Mode::kOffscreen) {
+    // The software renderer draws straight into a surface in system memory, so the video subsystem (and therefore a
+    // display) is not needed.  Only the event subsystem is brought up so that input can still be driven through SDL.
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+      std::cerr << "SDL could not initialize.\n";
+      std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+    }
+
+    sdl_surface = SDL_CreateRGBSurfaceWithFormat(0, screen_width, screen_height, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (nullptr == sdl_surface) {
+      std::cerr << "Surface could not be created.\n";
+      std::cerr << " SDL_Error: " << SDL_GetError() << "\n";
+      return;
+    }
+
+    sdl_renderer = SDL_CreateSoftwareRenderer(sdl_surface);
+    if (nullptr == sdl_renderer) {
+      std::cerr << "Renderer could not be created.\n";
+      std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+    }
+    return;
+  }
+
   // Initialize SDL
   if (SDL_Init(SDL_INIT_VIDEO) < 0) {
     std::cerr << "SDL could not initialize.\n";
@@ -38,13 +62,23 @@ Renderer::Renderer(const std::size_t screen_width,
 }
 
 Renderer::~Renderer() {
-  SDL_DestroyWindow(sdl_window);
+  if (nullptr != sdl_renderer) {
+    SDL_DestroyRenderer(sdl_renderer);
+  }
+  if (nullptr != sdl_surface) {
+    SDL_FreeSurface(sdl_surface);
+  }
+  if (nullptr != sdl_window) {
+    SDL_DestroyWindow(sdl_window);
+  }
   SDL_Quit();
 }
 
 // This method allows the caller to initiate a new render request to the Renderer:Render() method running in a thread.  Additionally, a pointer to a 
 // renderPromiseComplete promise is sent.  Renderere::Render() uses this to indicate that the requested 
-void Renderer::RegisterNewRenderRequest(std::promise<void> * renderCompletePromisePtr) {
+// render is complete.  inputOrigin is non-zero when this frame is the first to show the head turned by an input; the
+// input->present latency for it is recorded once the frame has been presented.
+void Renderer::RegisterNewRenderRequest(std::promise<void> * renderCompletePromisePtr, Uint64 inputOrigin) {
 
   // Adjust all of the synchronizing information under the _renderMutex to avoid any real time issues with the Renderer::Render() method running in a thread.
   std::lock_guard<std::mutex> renderGuard(_renderMutex);
@@ -52,6 +86,7 @@ void Renderer::RegisterNewRenderRequest(std::promise<void> * renderCompletePromi
   // Under the renderGuard, transfer the renterComplete promise to be set when the render is complete, and finally set the _procedeWithRender condition variable to 
   // signal to the Renderer::Render() running in a thread that it needs to start the render process.
   _renderCompletePromisePtr = renderCompletePromisePtr;
+  _renderInputOrigin = inputOrigin;
   _newRenderReady = true;
   _procedeWithRender.notify_one();
 
@@ -67,21 +102,13 @@ void Renderer::RegisterRenderTerminateRequest() {
   _procedeWithRender.notify_one();
 }
 
-void Renderer::SetFoodCoordinates(int x, int y) {
-  _food.x = x;
-  _food.y = y;
+// Input latency is only measured when a recorder is attached.  This must be called before the render thread is started.
+void Renderer::SetLatencyRecorder(LatencyRecorder *latencyRecorder) {
+  _latencyRecorder = latencyRecorder;
 }
 
-int Renderer::GetFoodXCoordinate() {
-  return(_food.x);
-}
-
-int Renderer::GetFoodYCoordinate() {
-  return(_food.y);
-}
-
-// This method is run in a thread.  To initiate a render request, the snake head and body and food
-void Renderer::Render(std::shared_ptr<Snake> const snake) {
+// This method is run in a thread.  To initiate a render request, the snake head and body and items
+void Renderer::Render(std::shared_ptr<Snake> const snake, std::shared_ptr<Board> const board) {
 
   bool newRender;
   std::unique_lock<std::mutex> renderLock(_renderMutex);
@@ -96,61 +123,126 @@ void Renderer::Render(std::shared_ptr<Snake> const snake) {
     // render to perform or 2) the user is requesting to exit and thus terminate the thread.
     _procedeWithRender.wait(renderLock, [this]{return ((_newRenderReady == true) || (_terminateRenderThread == true));});
     _newRenderReady = false;
+    Uint64 inputOrigin = _renderInputOrigin;
     renderLock.unlock();
 
     if (_terminateRenderThread) {
       break;
     }
    
-    SDL_Rect block;
-    block.w = screen_width / grid_width;
-    block.h = screen_height / grid_height;
+    RenderFrame(snake, board);
 
-    // Clear screen
-    SDL_SetRenderDrawColor(sdl_renderer, 0x1E, 0x1E, 0x1E, 0xFF);
-    SDL_RenderClear(sdl_renderer);
+    // The frame has left SDL_RenderPresent(), so any input it shows has now reached the display.
+    if (inputOrigin != 0 && _latencyRecorder != nullptr) {
+      _latencyRecorder->RecordPresent(inputOrigin);
+    }
 
-    // Render food
-    SDL_SetRenderDrawColor(sdl_renderer, 0xFF, 0xCC, 0x00, 0xFF);
-    block.x = _food.x * block.w;
-    block.y = _food.y * block.h;
-    SDL_RenderFillRect(sdl_renderer, &block);
+    // Signal to the game that the rendering is complete.
+    _renderCompletePromisePtr->set_value();
 
-    // Render snake's body
-    SDL_SetRenderDrawColor(sdl_renderer, 0xFF, 0xFF, 0xFF, 0xFF);
-    for (SDL_Point const &point : snake->body) {
-      block.x = point.x * block.w;
-      block.y = point.y * block.h;
-      SDL_RenderFillRect(sdl_renderer, &block);
-    }
+  }
+}
 
-    // Render snake's head
-    block.x = static_cast<int>(snake->GetSnakeHeadX()) * block.w;
-    block.y = static_cast<int>(snake->GetSnakeHeadY()) * block.h;
-    if (snake->alive) {
-      SDL_SetRenderDrawColor(sdl_renderer, 0x00, 0x7A, 0xCC, 0xFF);
-    } else {
-      SDL_SetRenderDrawColor(sdl_renderer, 0xFF, 0x00, 0x00, 0xFF);
+// Draws the items and snake and presents the frame.  Render() calls this from the render thread; the offscreen benchmark
+// calls it directly so that the drawing cost can be measured without the thread handoff.
+void Renderer::RenderFrame(std::shared_ptr<Snake> const snake, std::shared_ptr<Board> const board) {
+  // Fill colors indexed by Board::Item.
+  static constexpr Uint8 kItemColors[][3] = {
+      {0x00, 0x00, 0x00}, {0xFF, 0xCC, 0x00}, {0x4C, 0xAF, 0x50}, {0x00, 0xE5, 0xFF}, {0xB3, 0x88, 0xFF}};
+  static_assert(sizeof(kItemColors) / sizeof(kItemColors[0]) == Board::kItemKinds, "one fill color per Board::Item");
+
+  SDL_Rect block;
+  block.w = screen_width / grid_width;
+  block.h = screen_height / grid_height;
+
+  // Clear screen
+  SDL_SetRenderDrawColor(sdl_renderer, 0x1E, 0x1E, 0x1E, 0xFF);
+  SDL_RenderClear(sdl_renderer);
+
+  // Render items, batched by kind.
+  for (std::vector<SDL_Rect> &rects : _itemRects) {
+    rects.clear();
+  }
+  for (int cell : board->ItemCells()) {
+    int x = cell % board->GetWidth();
+    int y = cell / board->GetWidth();
+    block.x = x * block.w;
+    block.y = y * block.h;
+    _itemRects[static_cast<int>(board->ItemAt(x, y))].push_back(block);
+  }
+  for (int item = 1; item < Board::kItemKinds; item++) {
+    if (!_itemRects[item].empty()) {
+      SDL_SetRenderDrawColor(sdl_renderer, kItemColors[item][0], kItemColors[item][1], kItemColors[item][2], 0xFF);
+      SDL_RenderFillRects(sdl_renderer, _itemRects[item].data(), static_cast<int>(_itemRects[item].size()));
     }
-    SDL_RenderFillRect(sdl_renderer, &block);
+  }
+
+  // Render snake's body
+  _bodyRects.clear();
+  for (SDL_Point const &point : snake->body) {
+    block.x = point.x * block.w;
+    block.y = point.y * block.h;
+    _bodyRects.push_back(block);
+  }
+  if (!_bodyRects.empty()) {
+    SDL_SetRenderDrawColor(sdl_renderer, 0xFF, 0xFF, 0xFF, 0xFF);
+    SDL_RenderFillRects(sdl_renderer, _bodyRects.data(), static_cast<int>(_bodyRects.size()));
+  }
 
-    // Update Screen
-    SDL_RenderPresent(sdl_renderer);
+  // Render snake's head
+  block.x = static_cast<int>(snake->GetSnakeHeadX()) * block.w;
+  block.y = static_cast<int>(snake->GetSnakeHeadY()) * block.h;
+  if (snake->alive) {
+    SDL_SetRenderDrawColor(sdl_renderer, 0x00, 0x7A, 0xCC, 0xFF);
+  } else {
+    SDL_SetRenderDrawColor(sdl_renderer, 0xFF, 0x00, 0x00, 0xFF);
+  }
+  SDL_RenderFillRect(sdl_renderer, &block);
 
-    // Signal to the game that the rendering is complete.
-    _renderCompletePromisePtr->set_value();
+  // Update Screen
+  SDL_RenderPresent(sdl_renderer);
+}
+
+// Returns a 64-bit FNV-1a hash of the pixels of the last offscreen frame.  Frames that hash the same are pixel-identical,
+// which lets render changes be checked against golden hashes.  Windowed renderers have no surface to read and return 0.
+std::uint64_t Renderer::FrameHash() {
+  if (nullptr == sdl_surface) {
+    return 0;
+  }
 
+  std::uint64_t hash = 14695981039346656037ULL;
+  if (SDL_MUSTLOCK(sdl_surface)) {
+    SDL_LockSurface(sdl_surface);
+  }
+  // Hash row by row since the pitch may include padding bytes past the visible width.
+  const std::size_t rowBytes = static_cast<std::size_t>(sdl_surface->w) * 4;
+  for (int y = 0; y < sdl_surface->h; y++) {
+    const Uint8 *row = static_cast<const Uint8 *>(sdl_surface->pixels) + y * sdl_surface->pitch;
+    for (std::size_t i = 0; i < rowBytes; i++) {
+      hash ^= row[i];
+      hash *= 1099511628211ULL;
+    }
   }
+  if (SDL_MUSTLOCK(sdl_surface)) {
+    SDL_UnlockSurface(sdl_surface);
+  }
+  return hash;
 }
 
 // This displays the score, frames per second, andhigh score in the window title bar.
 void Renderer::UpdateWindowTitle(int score, int fps, int highScore) {
+  if (nullptr == sdl_window) {
+    return;
+  }
   std::string title{"Snake Score: " + std::to_string(score) + " FPS: " + std::to_string(fps) + "  High Score: " + std::to_string(highScore)};
   SDL_SetWindowTitle(sdl_window, title.c_str());
 }
 
 // After the snake has died, display the 2 choices in the window title to the user - "y" to start another game, "n" to end.
 void Renderer::DisplayPromptForNewGame() {
+  if (nullptr == sdl_window) {
+    return;
+  }
   std::string title{"****New Game? Press Y for yes, N for no****"};
   SDL_SetWindowTitle(sdl_window, title.c_str());
 }
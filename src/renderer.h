@@ -2,34 +2,45 @@
 #define RENDERER_H
 
 #include <vector>
+#include <cstdint>
 #include <future>
 #include <mutex>
 #include <condition_variable>
 #include "SDL.h"
 #include "snake.h"
+#include "board.h"
+#include "latency.h"
 
 class Renderer {
  public:
+  // kWindow renders to a visible window with an accelerated renderer.  kOffscreen renders into a software surface with
+  // no window at all, so frames can be benchmarked and hashed on headless machines.
+  enum class Mode { kWindow, kOffscreen };
+
   Renderer(const std::size_t screen_width, const std::size_t screen_height,
-           const std::size_t grid_width, const std::size_t grid_height);
+           const std::size_t grid_width, const std::size_t grid_height, Mode mode = Mode::kWindow);
   ~Renderer();
  
 
-  void Render(std::shared_ptr<Snake> const snake );
+  void Render(std::shared_ptr<Snake> const snake, std::shared_ptr<Board> const board);
+  void RenderFrame(std::shared_ptr<Snake> const snake, std::shared_ptr<Board> const board);
+  std::uint64_t FrameHash();
   void UpdateWindowTitle(int score, int fps, int highScrore);
-  void RegisterNewRenderRequest(std::promise<void> *renderCompletePromise);
+  void RegisterNewRenderRequest(std::promise<void> *renderCompletePromise, Uint64 inputOrigin = 0);
+  void SetLatencyRecorder(LatencyRecorder *latencyRecorder);
   void RegisterRenderTerminateRequest();
-  void SetFoodCoordinates(int x, int y);
-  int GetFoodXCoordinate();
-  int GetFoodYCoordinate();
   void DisplayPromptForNewGame();
 
   
 
  private:
-  SDL_Window *sdl_window;
-  SDL_Renderer *sdl_renderer;
-  SDL_Point _food;
+  SDL_Window *sdl_window{nullptr};
+  SDL_Renderer *sdl_renderer{nullptr};
+  SDL_Surface *sdl_surface{nullptr};
+  // Rectangles for each item kind and for the body, refilled every frame and drawn with one SDL_RenderFillRects() call
+  // each.  They keep their capacity between frames, so rendering does not allocate once the board has filled up.
+  std::vector<SDL_Rect> _itemRects[Board::kItemKinds];
+  std::vector<SDL_Rect> _bodyRects;
 
   const std::size_t screen_width;
   const std::size_t screen_height;
@@ -37,9 +48,11 @@ class Renderer {
   const std::size_t grid_height;
   std::mutex _renderMutex;
   std::condition_variable _procedeWithRender;
-  bool _newRenderReady;
-  bool _terminateRenderThread;
-  std::promise<void> *_renderCompletePromisePtr;
+  bool _newRenderReady{false};
+  bool _terminateRenderThread{false};
+  std::promise<void> *_renderCompletePromisePtr{nullptr};
+  Uint64 _renderInputOrigin{0};
+  LatencyRecorder *_latencyRecorder{nullptr};
   
 
 };
@@ -1,16 +1,37 @@
 #include "snake.h"
 #include <cmath>
 #include <iostream>
+#include <algorithm>
+
+// Registers the occupancy layer that this snake keeps up to date.  The cells the snake already covers are marked at once.
+void Snake::AttachBoard(Board *board) {
+  _board = board;
+  _board->Occupy(static_cast<int>(_head_x), static_cast<int>(_head_y));
+  for (auto const &item : body) {
+    _board->Occupy(item.x, item.y);
+  }
+}
 
 void Snake::ResetSnake()
 {
+  if (_board != nullptr) {
+    _board->Release(static_cast<int>(_head_x), static_cast<int>(_head_y));
+    for (auto const &item : body) {
+      _board->Release(item.x, item.y);
+    }
+  }
   _head_x = grid_width/2;
   _head_y = grid_height/2;
   size = 1;
   body.clear();
   alive = true;
   speed = .1f;
-  growing = false;
+  growth = 0;
+  inputOrigin = 0;
+  supersededInputs = 0;
+  if (_board != nullptr) {
+    _board->Occupy(static_cast<int>(_head_x), static_cast<int>(_head_y));
+  }
 
 }
 void Snake::Update() {
@@ -60,11 +81,15 @@ void Snake::UpdateBody(SDL_Point &current_head_cell, SDL_Point &prev_head_cell)
   // Add previous head location to vector
   body.push_back(prev_head_cell);
 
-  if (!growing) {
-    // Remove the tail from the vector.
+  if (growth == 0) {
+    // Remove the tail from the vector.  The tail cell is released before the head claims its new cell, since the head
+    // may be moving into the cell the tail just left.
+    if (_board != nullptr) {
+      _board->Release(body.front().x, body.front().y);
+    }
     body.erase(body.begin());
   } else {
-    growing = false;
+    growth--;
     size++;
   }
 
@@ -74,12 +99,58 @@ void Snake::UpdateBody(SDL_Point &current_head_cell, SDL_Point &prev_head_cell)
       alive = false;
     }
   }
+
+  if (_board != nullptr) {
+    _board->Occupy(current_head_cell.x, current_head_cell.y);
+  }
 }
 
-void Snake::GrowBody() { growing = true; }
+void Snake::GrowBody(int cells) { growth += cells; }
 
-// Inefficient method to check if cell is occupied by snake.
+// Removes up to the given number of cells from the tail.  The head is never removed.
+void Snake::ShrinkBody(int cells) {
+  int removed = std::min(cells, static_cast<int>(body.size()));
+  if (_board != nullptr) {
+    for (int i = 0; i < removed; i++) {
+      _board->Release(body[i].x, body[i].y);
+    }
+  }
+  body.erase(body.begin(), body.begin() + removed);
+  size -= removed;
+}
+
+// Applies the effect of an item the head has picked up and returns the points it scores.
+int Snake::Consume(Board::Item item) {
+  switch (item) {
+    case Board::Item::kFood:
+      // Grow snake and increase speed.
+      GrowBody();
+      speed += 0.005;
+      return 1;
+
+    case Board::Item::kGrowth:
+      GrowBody(3);
+      return 0;
+
+    case Board::Item::kSpeed:
+      speed += 0.02;
+      return 0;
+
+    case Board::Item::kShrink:
+      ShrinkBody(3);
+      return 0;
+
+    case Board::Item::kNone:
+      break;
+  }
+  return 0;
+}
+
+// Check if cell is occupied by snake.  This is a single lookup when a board is attached and a scan of the body otherwise.
 bool Snake::SnakeCell(int x, int y) {
+  if (_board != nullptr) {
+    return _board->Occupied(x, y);
+  }
   if (x == static_cast<int>(_head_x) && y == static_cast<int>(_head_y)) {
     return true;
   }
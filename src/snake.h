@@ -2,9 +2,11 @@
 #define SNAKE_H
 
 #include <vector>
+#include <cstdint>
 #include <mutex>
 #include <iostream>
 #include "SDL.h"
+#include "board.h"
 
 class Snake {
  public:
@@ -18,13 +20,21 @@ class Snake {
 
   void Update();
 
-  void GrowBody();
+  void AttachBoard(Board *board);
+  void GrowBody(int cells = 1);
+  void ShrinkBody(int cells);
+  int Consume(Board::Item item);
   bool SnakeCell(int x, int y);
   void ResetSnake();
-  float GetSnakeHeadX() {return _head_x;}
-  float GetSnakeHeadY() {return _head_y;}
+  float GetSnakeHeadX() const {return _head_x;}
+  float GetSnakeHeadY() const {return _head_y;}
+  void SetSnakeHead(float x, float y) {_head_x = x; _head_y = y;}
 
   Direction direction = Direction::kUp;
+  // Performance counter origin of the last accepted direction change that Game::Update() has not yet applied (0 if none).
+  Uint64 inputOrigin{0};
+  // Direction changes overwritten by a newer one before Game::Update() applied them.  They never reach the screen.
+  std::uint32_t supersededInputs{0};
 
   float speed{0.1f};
   int size{1};
@@ -36,7 +46,10 @@ class Snake {
   void UpdateHead();
   void UpdateBody(SDL_Point &current_cell, SDL_Point &prev_cell);
 
-  bool growing{false};
+  // Cells still to be added, one per move, from food or growth items.
+  int growth{0};
+  // Optional occupancy layer kept in step with the head and body (see AttachBoard()).
+  Board *_board{nullptr};
   int grid_width;
   int grid_height;
   float _head_x;
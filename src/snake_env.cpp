@@ -0,0 +1,114 @@
+#include "snake_env.h"
+#include <array>
+#include <cstring>
+
+SnakeEnv::SnakeEnv(std::size_t batchSize, int grid_width, int grid_height, std::size_t foodCount,
+                   std::size_t powerUpCount)
+    : _gridWidth(grid_width), _gridHeight(grid_height), _foodCount(foodCount), _powerUpCount(powerUpCount) {
+  _games.reserve(batchSize);
+  for (std::size_t i = 0; i < batchSize; i++) {
+    auto instance = std::make_unique<Instance>(grid_width, grid_height);
+    // Give the body its full capacity now so that stepping never has to grow it.  Board::TrackChanges() does the same
+    // for the change list.
+    instance->snake.body.reserve(grid_width * grid_height);
+    instance->snake.AttachBoard(&instance->board);
+    instance->board.TrackChanges(true);
+    _games.push_back(std::move(instance));
+  }
+}
+
+int SnakeEnv::HeadCell(const Instance &instance) const {
+  return static_cast<int>(instance.snake.GetSnakeHeadY()) * _gridWidth + static_cast<int>(instance.snake.GetSnakeHeadX());
+}
+
+// Same draw layout as Game::SpawnItem(): Board::SpawnItem() picks the cell and the second word the power-up kind.
+void SnakeEnv::SpawnItem(Instance &instance, bool powerUp) {
+  std::array<std::uint32_t, 4> draw = instance.itemRng.Block(instance.itemDraw++);
+  Board::Item item = powerUp ? Board::RandomPowerUp(draw[1]) : Board::Item::kFood;
+  instance.board.SpawnItem(item, draw);
+}
+
+void SnakeEnv::Reset(const std::uint64_t *seeds, std::uint8_t *observations) {
+  for (std::size_t game = 0; game < _games.size(); game++) {
+    ResetOne(game, seeds[game], observations);
+  }
+}
+
+void SnakeEnv::ResetOne(std::size_t game, std::uint64_t seed, std::uint8_t *observations) {
+  Instance &instance = *_games[game];
+  // Rebuild the board rather than only clearing it, so that nothing from the previous game carries over.
+  instance.board.Reset();
+  instance.snake.ResetSnake();
+  instance.snake.direction = Snake::Direction::kUp;
+  instance.snake.speed = 1.0f;
+  instance.itemRng = CounterRng(seed, game);
+  instance.itemDraw = 0;
+  instance.done = false;
+  for (std::size_t i = 0; i < _foodCount; i++) {
+    SpawnItem(instance, false);
+  }
+  for (std::size_t i = 0; i < _powerUpCount; i++) {
+    SpawnItem(instance, true);
+  }
+  instance.board.ClearChanges();
+  EncodeFull(game, observations);
+}
+
+void SnakeEnv::EncodeCell(const Instance &instance, int cell, std::uint8_t *observation) const {
+  const std::size_t planeSize = _gridWidth * _gridHeight;
+  int x = cell % _gridWidth;
+  int y = cell / _gridWidth;
+  bool head = cell == HeadCell(instance);
+  observation[kBodyPlane * planeSize + cell] = instance.board.Occupied(x, y) && !head ? 1 : 0;
+  observation[kHeadPlane * planeSize + cell] = head ? 1 : 0;
+  observation[kItemPlane * planeSize + cell] = static_cast<std::uint8_t>(instance.board.ItemAt(x, y));
+}
+
+void SnakeEnv::EncodeFull(std::size_t game, std::uint8_t *observations) const {
+  std::uint8_t *observation = observations + game * ObservationSize();
+  std::memset(observation, 0, ObservationSize());
+  for (int cell = 0; cell < _gridWidth * _gridHeight; cell++) {
+    EncodeCell(*_games[game], cell, observation);
+  }
+}
+
+void SnakeEnv::Step(const std::uint8_t *actions, std::uint8_t *observations, float *rewards, std::uint8_t *dones) {
+  constexpr Snake::Direction kOpposite[] = {Snake::Direction::kDown, Snake::Direction::kUp, Snake::Direction::kRight,
+                                            Snake::Direction::kLeft};
+
+  for (std::size_t game = 0; game < _games.size(); game++) {
+    Instance &instance = *_games[game];
+    Snake &snake = instance.snake;
+    rewards[game] = 0;
+    if (instance.done) {
+      dones[game] = 1;
+      continue;
+    }
+
+    Snake::Direction input = static_cast<Snake::Direction>(actions[game] & 3);
+    if (snake.direction != kOpposite[actions[game] & 3] || snake.size == 1) {
+      snake.direction = input;
+    }
+
+    int previousHead = HeadCell(instance);
+    snake.Update();
+    int head = HeadCell(instance);
+    Board::Item item = instance.board.TakeItem(head % _gridWidth, head / _gridWidth);
+    if (item != Board::Item::kNone) {
+      rewards[game] = static_cast<float>(snake.Consume(item));
+      SpawnItem(instance, item != Board::Item::kFood);
+      snake.speed = 1.0f;
+    }
+    instance.done = !snake.alive;
+    dones[game] = instance.done ? 1 : 0;
+
+    // Re-encode only what moved: every cell the board reports as changed, plus the old head cell, which stays occupied
+    // (and so is not reported) but turns from head into body.
+    std::uint8_t *observation = observations + game * ObservationSize();
+    EncodeCell(instance, previousHead, observation);
+    for (int cell : instance.board.ChangedCells()) {
+      EncodeCell(instance, cell, observation);
+    }
+    instance.board.ClearChanges();
+  }
+}
@@ -0,0 +1,74 @@
+#ifndef SNAKE_ENV_H
+#define SNAKE_ENV_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "board.h"
+#include "counter_rng.h"
+#include "snake.h"
+
+// Batched, headless environment for driving many games from a training loop.  Unlike Game::Run() it owns no threads,
+// no loop and no SDL state: the caller resets and steps every game in the batch and the environment writes
+// observations straight into caller-provided memory.
+//
+// Each step moves every snake exactly one cell.  Games follow the normal rules (wrap-around, self collision, food and
+// power-ups via Snake::Consume()), except that a snake's speed is held at one cell per step.
+//
+// Observations are uint8 tensors laid out contiguously as [game][plane][y][x] with three planes:
+//   kBodyPlane  1 where a body segment is, 0 elsewhere
+//   kHeadPlane  1 at the head, 0 elsewhere
+//   kItemPlane  the Board::Item on the cell (0 for none, 1 for food, 2..4 for power-ups)
+// Reset() writes a game's observation in full.  Step() then updates only the cells that changed, so the buffer passed to
+// Step() must be the one that was passed to Reset() and must not be modified in between.  Step() does not allocate.
+class SnakeEnv {
+ public:
+  enum Plane { kBodyPlane, kHeadPlane, kItemPlane, kPlaneCount };
+
+  SnakeEnv(std::size_t batchSize, int grid_width, int grid_height, std::size_t foodCount = 1,
+           std::size_t powerUpCount = 0);
+
+  std::size_t BatchSize() const { return _games.size(); }
+  // Bytes of observation per game; the batch buffer holds BatchSize() * ObservationSize() bytes.
+  std::size_t ObservationSize() const { return kPlaneCount * _gridWidth * _gridHeight; }
+
+  // Starts a new game in every slot.  Game i draws its items from the counter RNG stream (seeds[i], i) onto a board rebuilt
+  // from scratch, so resetting with the same seeds and then stepping with the same actions gives the same observations,
+  // whatever the environment did before.
+  void Reset(const std::uint64_t *seeds, std::uint8_t *observations);
+  // Starts a new game in one slot, e.g. after it reports done.
+  void ResetOne(std::size_t game, std::uint64_t seed, std::uint8_t *observations);
+
+  // Applies one action per game (the value of a Snake::Direction) and advances every game by one cell.  Reversing onto
+  // the body is ignored, as in Controller::ChangeDirection().  rewards receives the points scored this step and dones is
+  // set to 1 once a snake has died; finished games stay finished until they are reset.
+  void Step(const std::uint8_t *actions, std::uint8_t *observations, float *rewards, std::uint8_t *dones);
+
+  // Writes a game's full observation from scratch.  Step() never needs this; it is exposed for checking the
+  // incremental encoding.
+  void EncodeFull(std::size_t game, std::uint8_t *observations) const;
+
+ private:
+  struct Instance {
+    Instance(int grid_width, int grid_height) : snake(grid_width, grid_height), board(grid_width, grid_height) {}
+
+    Snake snake;
+    Board board;
+    CounterRng itemRng{0, 0};
+    std::uint64_t itemDraw{0};
+    bool done{false};
+  };
+
+  void SpawnItem(Instance &instance, bool powerUp);
+  void EncodeCell(const Instance &instance, int cell, std::uint8_t *observation) const;
+  int HeadCell(const Instance &instance) const;
+
+  int _gridWidth;
+  int _gridHeight;
+  std::size_t _foodCount;
+  std::size_t _powerUpCount;
+  // Instances hold a Snake, whose mutex makes it immovable, so they are allocated once up front.
+  std::vector<std::unique_ptr<Instance>> _games;
+};
+
+#endif
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "SDL.h"
+#include "controller.h"
+#include "counter_rng.h"
+#include "disk.h"
+#include "game.h"
+#include "input_injection.h"
+#include "renderer.h"
+
+// Long-running soak test.  Plays thousands of consecutive games in one process through the real Game::Run() loop,
+// rendering offscreen with no frame delay and driving input with random SDL_PushEvent() key presses.  At a fixed
+// interval it samples resident memory, thread count, open file descriptors and Game::Update() latency percentiles, and
+// at the end fails if any of them has grown beyond its threshold between the start and the end of the run.  A run too
+// short to take enough samples also fails, since nothing was checked.  Sampling reads /proc, so this tool is Linux only.
+//
+// Usage: SoakTest [--games N] [--sample-ms N] [--input-ms N] [--max-rss-growth-kb N] [--max-thread-growth N]
+//                 [--max-fd-growth N] [--max-latency-drift X] [--latency-floor-us X]
+
+namespace {
+
+constexpr std::size_t kScreenWidth{160};
+constexpr std::size_t kScreenHeight{160};
+constexpr std::size_t kGridWidth{16};
+constexpr std::size_t kGridHeight{16};
+constexpr std::size_t kFoodCount{24};
+constexpr std::size_t kPowerUpCount{8};
+
+struct Sample {
+  double seconds;
+  int games;
+  long rssKb;
+  int threads;
+  int fds;
+  double tickP50Us;
+  double tickP99Us;
+};
+
+long ReadRssKb() {
+  std::ifstream statm("/proc/self/statm");
+  long pages = 0;
+  long residentPages = 0;
+  statm >> pages >> residentPages;
+  return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+int ReadThreadCount() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 8, "Threads:") == 0) {
+      return std::atoi(line.c_str() + 8);
+    }
+  }
+  return 0;
+}
+
+int ReadOpenFdCount() {
+  DIR *fdDir = opendir("/proc/self/fd");
+  if (fdDir == nullptr) {
+    return 0;
+  }
+  int count = 0;
+  while (dirent *entry = readdir(fdDir)) {
+    if (entry->d_name[0] != '.') {
+      count++;
+    }
+  }
+  closedir(fdDir);
+  // Do not count the descriptor opendir() itself holds.
+  return count - 1;
+}
+
+// Exact percentile of a window of raw samples.  Reorders the values.
+double Percentile(std::vector<double> &values, double percent) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::size_t rank = std::min(values.size() - 1, static_cast<std::size_t>(percent / 100 * values.size()));
+  std::nth_element(values.begin(), values.begin() + rank, values.end());
+  return values[rank];
+}
+
+double Median(std::vector<double> values) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+// Compares the median of a metric over the first and last quarter of the samples (after warm-up).  Medians keep a single
+// noisy sample from failing or hiding a trend.
+template <typename Metric>
+void QuarterMedians(const std::vector<Sample> &samples, Metric metric, double &first, double &last) {
+  std::size_t quarter = std::max<std::size_t>(1, samples.size() / 4);
+  std::vector<double> head;
+  std::vector<double> tail;
+  for (std::size_t i = 0; i < quarter; i++) {
+    head.push_back(metric(samples[i]));
+    tail.push_back(metric(samples[samples.size() - 1 - i]));
+  }
+  first = Median(head);
+  last = Median(tail);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  int targetGames = 2000;
+  int sampleMs = 1000;
+  int inputMs = 2;
+  double maxRssGrowthKb = 4096;
+  double maxThreadGrowth = 0;
+  double maxFdGrowth = 0;
+  double maxLatencyDrift = 1.5;
+  double latencyFloorUs = 5;
+
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+      targetGames = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--sample-ms") == 0 && i + 1 < argc) {
+      sampleMs = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--input-ms") == 0 && i + 1 < argc) {
+      inputMs = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--max-rss-growth-kb") == 0 && i + 1 < argc) {
+      maxRssGrowthKb = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--max-thread-growth") == 0 && i + 1 < argc) {
+      maxThreadGrowth = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--max-fd-growth") == 0 && i + 1 < argc) {
+      maxFdGrowth = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--max-latency-drift") == 0 && i + 1 < argc) {
+      maxLatencyDrift = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--latency-floor-us") == 0 && i + 1 < argc) {
+      latencyFloorUs = std::atof(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--games N] [--sample-ms N] [--input-ms N] [--max-rss-growth-kb N] [--max-thread-growth N]"
+                   " [--max-fd-growth N] [--max-latency-drift X] [--latency-floor-us X]\n";
+      return 2;
+    }
+  }
+
+  std::unique_ptr<Renderer> renderer = std::make_unique<Renderer>(kScreenWidth, kScreenHeight, kGridWidth, kGridHeight,
+                                                                  Renderer::Mode::kOffscreen);
+  Controller controller;
+  Game game(kGridWidth, kGridHeight, Disk("./SoakTestHighScore"), 1, 0, kFoodCount, kPowerUpCount);
+
+  // Raw Update() latencies for the current sampling window.  A tick on this board takes well under a microsecond, so
+  // histogram buckets would be as wide as the values themselves and percentiles are taken exactly instead.  The game
+  // thread appends under tickMutex and the monitor thread swaps the window out for an empty buffer; both buffers keep
+  // their capacity, so once the first windows have been seen neither allocates.
+  std::mutex tickMutex;
+  std::vector<double> tickWindow;
+  std::vector<double> tickSorted;
+  game.SetTickObserver([&tickMutex, &tickWindow](double microseconds) {
+    std::lock_guard<std::mutex> tickGuard(tickMutex);
+    tickWindow.push_back(microseconds);
+  });
+
+  std::vector<Sample> samples;
+  std::thread monitorThread([&]() {
+    constexpr SDL_Keycode kArrows[] = {SDLK_UP, SDLK_DOWN, SDLK_LEFT, SDLK_RIGHT};
+    CounterRng inputRng(2, 0);
+    std::uint64_t inputDraw = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto nextSample = start + std::chrono::milliseconds(sampleMs);
+
+    while (game.GetGamesPlayed() < targetGames) {
+      // A random turn, then a "y" so that a new game starts right away after the snake dies.  Controller::HandleInput()
+      // ignores the "y" during play.
+      PushKey(kArrows[CounterRng::UniformInt(inputRng.Block(inputDraw++)[0], 4)]);
+      PushKey(SDLK_y);
+      std::this_thread::sleep_for(std::chrono::milliseconds(inputMs));
+
+      auto now = std::chrono::steady_clock::now();
+      if (now >= nextSample) {
+        Sample sample;
+        sample.seconds = std::chrono::duration<double>(now - start).count();
+        sample.games = game.GetGamesPlayed();
+        sample.rssKb = ReadRssKb();
+        sample.threads = ReadThreadCount();
+        sample.fds = ReadOpenFdCount();
+        tickSorted.clear();
+        {
+          std::lock_guard<std::mutex> tickGuard(tickMutex);
+          tickWindow.swap(tickSorted);
+        }
+        sample.tickP50Us = Percentile(tickSorted, 50);
+        sample.tickP99Us = Percentile(tickSorted, 99);
+        samples.push_back(sample);
+        std::cout << std::fixed << std::setprecision(1) << "t=" << sample.seconds << "s games=" << sample.games
+                  << " rss=" << sample.rssKb << "KB threads=" << sample.threads << " fds=" << sample.fds
+                  << std::setprecision(2) << " tick p50=" << sample.tickP50Us << "us p99=" << sample.tickP99Us
+                  << "us\n";
+        nextSample += std::chrono::milliseconds(sampleMs);
+      }
+    }
+    PushQuit();
+  });
+
+  game.Run(controller, std::move(renderer), 0);
+  monitorThread.join();
+
+  // Allocators, SDL and the thread pool settle during the first samples, so they are left out of the comparison.
+  std::size_t warmup = std::max<std::size_t>(1, samples.size() / 10);
+  if (samples.size() < warmup + 8) {
+    std::cout << "Only " << samples.size() << " samples were taken, too few to check for drift; run more games or "
+              << "sample more often.\n";
+    return 1;
+  }
+  std::vector<Sample> steady(samples.begin() + warmup, samples.end());
+
+  bool failed = false;
+  auto check = [&failed](const char *name, double first, double last, double growth, double limit) {
+    bool ok = growth <= limit;
+    std::cout << std::fixed << std::setprecision(2) << name << ": " << first << " -> " << last << " (limit " << limit
+              << ") " << (ok ? "ok" : "FAIL") << "\n";
+    failed = failed || !ok;
+  };
+
+  double first, last;
+  QuarterMedians(steady, [](const Sample &s) { return static_cast<double>(s.rssKb); }, first, last);
+  check("rss growth KB", first, last, last - first, maxRssGrowthKb);
+  QuarterMedians(steady, [](const Sample &s) { return static_cast<double>(s.threads); }, first, last);
+  check("thread growth", first, last, last - first, maxThreadGrowth);
+  QuarterMedians(steady, [](const Sample &s) { return static_cast<double>(s.fds); }, first, last);
+  check("fd growth", first, last, last - first, maxFdGrowth);
+  QuarterMedians(steady, [](const Sample &s) { return s.tickP99Us; }, first, last);
+  // Below the floor a change is timer noise rather than drift, so both ends are raised to it before taking the ratio.
+  check("tick p99 drift", first, last, std::max(last, latencyFloorUs) / std::max(first, latencyFloorUs),
+        maxLatencyDrift);
+
+  std::cout << game.GetGamesPlayed() << " games played.\n";
+  return failed ? 1 : 0;
+}
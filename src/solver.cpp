@@ -0,0 +1,606 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "counter_rng.h"
+
+// Exhaustive solver for small boards (up to 16x16).  A position is a set of bitboards plus the body as a ring of cells,
+// and moves follow the same rules as Snake::UpdateHead() / Snake::UpdateBody() at one cell per move:
+//   - the head wraps around the edges of the board,
+//   - the tail cell is vacated before the collision check, so the head may follow directly behind the tail,
+//   - food makes the snake grow by one cell on the move after it is eaten,
+//   - reversing is only allowed while the snake is a single cell (Controller::ChangeDirection()).
+// Food is the only item.  Each new food is drawn from the counter RNG stream (seed, game id) with the eaten count as the
+// draw index and lands on a free cell chosen the same way as Board::SpawnItem() does it in the game.
+//
+// Two searches are offered:
+//   --target-food N  fewest moves needed to eat N foods (IDA* with a wrap-around Manhattan distance bound)
+//   --survive N --min-food K  any sequence of exactly N moves that does not collide and eats at least K foods on the
+//                             way (depth-first to N moves, pruned by the same distance bound for the remaining foods)
+// Worker threads split the search tree below a shallow frontier and share a lock-free transposition table that
+// remembers positions which already failed with at least as many moves left (exactly as many for --survive).
+//
+// Usage: SnakeSolver [--width N] [--height N] [--target-food N | --survive N --min-food K] [--seed N] [--game-id N]
+//                    [--threads N] [--tt-mb N] [--max-moves N]
+
+namespace {
+
+constexpr int kMaxCells{256};
+constexpr int kNoFood{kMaxCells};
+// Deepest search allowed.  Each worker holds one frame (a little over one position) per move of depth.
+constexpr int kMaxDepth{100000};
+
+enum Direction : std::uint8_t { kUp, kDown, kLeft, kRight };
+constexpr Direction kOpposite[] = {kDown, kUp, kRight, kLeft};
+constexpr char kMoveNames[] = {'U', 'D', 'L', 'R'};
+
+struct Bitboard {
+  std::uint64_t words[kMaxCells / 64]{};
+
+  bool Test(int cell) const { return (words[cell >> 6] >> (cell & 63)) & 1; }
+  void Set(int cell) { words[cell >> 6] |= std::uint64_t{1} << (cell & 63); }
+  void Clear(int cell) { words[cell >> 6] &= ~(std::uint64_t{1} << (cell & 63)); }
+};
+
+// Zobrist keys.  The body is hashed as (cell, direction to the next segment) links rather than plain occupancy, so two
+// snakes covering the same cells in a different order never share a key.
+struct Zobrist {
+  std::uint64_t head[kMaxCells];
+  std::uint64_t link[kMaxCells][4];
+  std::uint64_t food[kMaxCells + 1];
+  std::uint64_t direction[4];
+  std::uint64_t growth[kMaxCells];
+  std::uint64_t eaten[kMaxCells];
+
+  Zobrist() {
+    std::uint64_t x = 0x9E3779B97F4A7C15ULL;
+    auto next = [&x]() {
+      // splitmix64
+      std::uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      return z ^ (z >> 31);
+    };
+    for (auto &key : head) key = next();
+    for (auto &keys : link)
+      for (auto &key : keys) key = next();
+    for (auto &key : food) key = next();
+    for (auto &key : direction) key = next();
+    for (auto &key : growth) key = next();
+    for (auto &key : eaten) key = next();
+  }
+};
+
+const Zobrist kZobrist;
+
+struct Board {
+  int width;
+  int height;
+  Bitboard valid;
+  CounterRng foodRng;
+};
+
+// A position.  cells[] is a ring holding the snake from tail to head, and links[i] is the direction from cells[i] to
+// the following segment.  Positions are copied on every move, which keeps the search free of undo bookkeeping.
+struct State {
+  Bitboard body;
+  std::uint8_t cells[kMaxCells];
+  std::uint8_t links[kMaxCells];
+  std::uint8_t tail;
+  std::uint16_t length;
+  std::uint8_t head;
+  std::uint16_t food;
+  Direction direction;
+  std::uint8_t growth;
+  std::uint8_t eaten;
+  std::uint64_t key;
+};
+
+int CellOf(const Board &board, int x, int y) { return y * board.width + x; }
+
+// Picks the cell for the next food.  The fallback selects the k-th free bit across the board's words.
+int DrawFood(const Board &board, const State &state) {
+  std::uint64_t free[kMaxCells / 64];
+  int freeCount = 0;
+  for (int i = 0; i < kMaxCells / 64; i++) {
+    free[i] = board.valid.words[i] & ~state.body.words[i];
+    freeCount += __builtin_popcountll(free[i]);
+  }
+  if (freeCount == 0) {
+    return kNoFood;
+  }
+  // Same rule as Board::SpawnItem(): probe the whole grid with words 0, 2 and 3, then fall back to the k-th free cell.
+  std::array<std::uint32_t, 4> draw = board.foodRng.Block(state.eaten);
+  for (std::uint32_t word : {draw[0], draw[2], draw[3]}) {
+    int cell = CounterRng::UniformInt(word, board.width * board.height);
+    if ((free[cell / 64] >> (cell % 64)) & 1) {
+      return cell;
+    }
+  }
+  int rank = CounterRng::UniformInt(draw[0], freeCount);
+  for (int i = 0; i < kMaxCells / 64; i++) {
+    int count = __builtin_popcountll(free[i]);
+    if (rank < count) {
+      std::uint64_t word = free[i];
+      for (int skip = 0; skip < rank; skip++) {
+        word &= word - 1;
+      }
+      return i * 64 + __builtin_ctzll(word);
+    }
+    rank -= count;
+  }
+  return kNoFood;
+}
+
+State InitialState(const Board &board) {
+  State state{};
+  // Same starting point as the Snake constructor: a single cell in the middle heading up.
+  state.head = CellOf(board, board.width / 2, board.height / 2);
+  state.cells[0] = state.head;
+  state.length = 1;
+  state.direction = kUp;
+  state.body.Set(state.head);
+  state.food = DrawFood(board, state);
+  state.key = kZobrist.head[state.head] ^ kZobrist.food[state.food] ^ kZobrist.direction[kUp] ^ kZobrist.growth[0] ^
+              kZobrist.eaten[0];
+  return state;
+}
+
+int Neighbour(const Board &board, int cell, Direction direction) {
+  int x = cell % board.width;
+  int y = cell / board.width;
+  switch (direction) {
+    case kUp:
+      y = (y + board.height - 1) % board.height;
+      break;
+    case kDown:
+      y = (y + 1) % board.height;
+      break;
+    case kLeft:
+      x = (x + board.width - 1) % board.width;
+      break;
+    case kRight:
+      x = (x + 1) % board.width;
+      break;
+  }
+  return CellOf(board, x, y);
+}
+
+// Plays one move from state into next.  Returns false if the move is not allowed or the head collides with the body.
+bool ApplyMove(const Board &board, const State &state, Direction direction, State &next) {
+  if (state.length > 1 && direction == kOpposite[state.direction]) {
+    return false;
+  }
+  next = state;
+  int newHead = Neighbour(board, state.head, direction);
+
+  // The old head becomes a body segment linked to the new head.
+  std::uint8_t headSlot = static_cast<std::uint8_t>(state.tail + state.length - 1);
+  next.links[headSlot] = direction;
+  next.cells[static_cast<std::uint8_t>(headSlot + 1)] = newHead;
+  next.length++;
+  next.key ^= kZobrist.link[state.head][direction] ^ kZobrist.head[state.head] ^ kZobrist.head[newHead];
+
+  // Drop the tail unless the snake is still growing from food.
+  if (next.growth == 0) {
+    int tailCell = next.cells[next.tail];
+    next.key ^= kZobrist.link[tailCell][next.links[next.tail]];
+    next.body.Clear(tailCell);
+    next.tail++;
+    next.length--;
+  } else {
+    next.key ^= kZobrist.growth[next.growth] ^ kZobrist.growth[next.growth - 1];
+    next.growth--;
+  }
+
+  if (next.body.Test(newHead)) {
+    return false;
+  }
+  next.body.Set(newHead);
+  next.head = newHead;
+  next.key ^= kZobrist.direction[state.direction] ^ kZobrist.direction[direction];
+  next.direction = direction;
+
+  if (newHead == next.food) {
+    next.key ^= kZobrist.growth[next.growth] ^ kZobrist.growth[next.growth + 1];
+    next.growth++;
+    next.key ^= kZobrist.eaten[next.eaten] ^ kZobrist.eaten[next.eaten + 1];
+    next.eaten++;
+    next.key ^= kZobrist.food[next.food];
+    next.food = DrawFood(board, next);
+    next.key ^= kZobrist.food[next.food];
+  }
+  return true;
+}
+
+// Transposition table entry written without locks.  The key is stored xor'ed with the data, so an entry torn by a
+// concurrent write fails the key check on probe and is simply treated as a miss.
+struct TableEntry {
+  std::atomic<std::uint64_t> check{0};
+  std::atomic<std::uint64_t> data{0};
+};
+
+class TranspositionTable {
+ public:
+  explicit TranspositionTable(std::size_t megabytes) {
+    std::size_t entries = 1;
+    while (entries * 2 * sizeof(TableEntry) <= megabytes * 1024 * 1024) {
+      entries *= 2;
+    }
+    _mask = entries - 1;
+    _entries.reset(new TableEntry[entries]);
+  }
+
+  // Returns the number of remaining moves with which this position was recorded as failing, or -1.
+  int FailedBudget(std::uint64_t key) const {
+    const TableEntry &entry = _entries[key & _mask];
+    std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    std::uint64_t check = entry.check.load(std::memory_order_relaxed);
+    return (check ^ data) == key ? static_cast<int>(data) : -1;
+  }
+
+  // Records that a position failed with this many moves left.  With keepLarger an entry that already holds a larger
+  // budget for the same key is kept, since it prunes more.
+  void StoreFailure(std::uint64_t key, int budget, bool keepLarger) {
+    TableEntry &entry = _entries[key & _mask];
+    if (keepLarger && FailedBudget(key) >= budget) {
+      return;
+    }
+    std::uint64_t data = static_cast<std::uint64_t>(budget);
+    entry.data.store(data, std::memory_order_relaxed);
+    entry.check.store(key ^ data, std::memory_order_relaxed);
+  }
+
+  std::size_t Bytes() const { return (_mask + 1) * sizeof(TableEntry); }
+
+ private:
+  std::unique_ptr<TableEntry[]> _entries;
+  std::size_t _mask;
+};
+
+struct Search {
+  Board board;
+  bool survive;
+  int target;  // foods to eat
+  int surviveMoves;
+  TranspositionTable table;
+  std::atomic<bool> found{false};
+  std::atomic<std::uint64_t> nodes{0};
+  std::mutex solutionMutex;
+  std::vector<Direction> solution;
+
+  Search(const Board &board, int target, int surviveMoves, std::size_t tableMegabytes)
+      : board(board), survive(surviveMoves > 0), target(target), surviveMoves(surviveMoves), table(tableMegabytes) {}
+
+  bool IsGoal(const State &state, int moves) const {
+    return state.eaten >= target && (!survive || moves == surviveMoves);
+  }
+
+  // Whether a position is already known to fail with this many moves left.  When the goal counts at any depth, failing
+  // with more moves left implies failing with fewer.  Survival needs exactly surviveMoves moves, and a position that
+  // cannot last b1 more moves may still last b2 < b1, so there only the same budget carries over.
+  bool KnownToFail(const State &state, int budget) const {
+    int failed = table.FailedBudget(state.key);
+    return survive ? failed == budget : failed >= budget;
+  }
+
+  void RecordFailure(const State &state, int budget) { table.StoreFailure(state.key, budget, !survive); }
+
+  // Moves between two cells on the wrap-around board, ignoring the body.
+  int Distance(int from, int to) const {
+    if (to == kNoFood) {
+      return 0;
+    }
+    int dx = std::abs(from % board.width - to % board.width);
+    int dy = std::abs(from / board.width - to / board.width);
+    return std::min(dx, board.width - dx) + std::min(dy, board.height - dy);
+  }
+
+  // Lower bound on the moves still needed to eat the remaining foods.  Survival also has to reach its fixed depth, which
+  // the move threshold already enforces.
+  int Heuristic(const State &state) const {
+    if (state.eaten >= target || state.food == kNoFood) {
+      return 0;
+    }
+    return Distance(state.head, state.food) + (target - state.eaten - 1);
+  }
+
+  void RecordSolution(const std::vector<Direction> &moves) {
+    std::lock_guard<std::mutex> solutionGuard(solutionMutex);
+    if (!found) {
+      solution = moves;
+      found = true;
+    }
+  }
+};
+
+struct FrontierNode {
+  State state;
+  std::vector<Direction> moves;
+};
+
+// Depth-first search with an explicit stack.  Each depth has one preallocated frame holding its position and the
+// order in which its moves are tried, so the search depth is limited by the frame buffer rather than the thread stack.
+class Worker {
+ public:
+  Worker(Search &search, int index, int maxDepth) : _search(search), _index(index), _frames(maxDepth + 1) {
+    _path.reserve(maxDepth);
+  }
+
+  // Searches below one frontier node with the given move threshold.  Returns true when a solution was found.
+  bool Run(const FrontierNode &node, int threshold) {
+    const int base = static_cast<int>(node.moves.size());
+    _threshold = threshold;
+    _path.assign(node.moves.begin(), node.moves.end());
+    _frames[base].state = node.state;
+
+    Visit visit = Enter(base);
+    bool solved = visit == Visit::kSolved;
+    int depth = base;
+    while (visit == Visit::kExpanded && !solved && !_search.found.load(std::memory_order_relaxed)) {
+      Frame &frame = _frames[depth];
+      if (frame.next == frame.count) {
+        // Every move from here failed.  Only a completely searched subtree is recorded as a failure.
+        if (!_search.found.load(std::memory_order_relaxed)) {
+          _search.RecordFailure(frame.state, frame.budget);
+        }
+        if (depth == base) {
+          break;
+        }
+        _path.pop_back();
+        depth--;
+        continue;
+      }
+
+      Direction direction = frame.order[frame.next++];
+      if (!ApplyMove(_search.board, frame.state, direction, _frames[depth + 1].state)) {
+        continue;
+      }
+      _path.push_back(direction);
+      Visit child = Enter(depth + 1);
+      if (child == Visit::kSolved) {
+        solved = true;
+      } else if (child == Visit::kExpanded) {
+        depth++;
+      } else {
+        _path.pop_back();
+      }
+    }
+
+    _search.nodes += _nodes;
+    _nodes = 0;
+    return solved;
+  }
+
+  std::size_t StackBytes() const { return _frames.size() * sizeof(Frame); }
+
+ private:
+  enum class Visit { kSolved, kPruned, kExpanded };
+
+  struct Frame {
+    State state;
+    int budget;
+    int count;
+    int next;
+    std::array<Direction, 4> order;
+  };
+
+  // Checks the position in the frame at this depth and, unless it is a goal or can be pruned, prepares its moves.
+  Visit Enter(int depth) {
+    _nodes++;
+    Frame &frame = _frames[depth];
+    if (_search.IsGoal(frame.state, depth)) {
+      _search.RecordSolution(_path);
+      return Visit::kSolved;
+    }
+    if (_search.found.load(std::memory_order_relaxed)) {
+      return Visit::kPruned;
+    }
+    frame.budget = _threshold - depth;
+    if (frame.budget <= 0 || _search.Heuristic(frame.state) > frame.budget ||
+        _search.KnownToFail(frame.state, frame.budget)) {
+      return Visit::kPruned;
+    }
+
+    // Moves are tried closest-to-food first; ties are broken in a per-thread order so that threads sharing the table
+    // spread out over different parts of the tree.  Moves that collide are skipped when they are applied.
+    std::array<int, 4> estimate;
+    frame.count = 0;
+    frame.next = 0;
+    for (int i = 0; i < 4; i++) {
+      Direction direction = static_cast<Direction>((i + _index) & 3);
+      if (frame.state.length > 1 && direction == kOpposite[frame.state.direction]) {
+        continue;
+      }
+      int slot = frame.count++;
+      frame.order[slot] = direction;
+      estimate[slot] = _search.Distance(Neighbour(_search.board, frame.state.head, direction), frame.state.food);
+      for (; slot > 0 && estimate[slot] < estimate[slot - 1]; slot--) {
+        std::swap(estimate[slot], estimate[slot - 1]);
+        std::swap(frame.order[slot], frame.order[slot - 1]);
+      }
+    }
+    return Visit::kExpanded;
+  }
+
+  Search &_search;
+  int _index;
+  int _threshold{0};
+  std::uint64_t _nodes{0};
+  std::vector<Direction> _path;
+  std::vector<Frame> _frames;
+};
+
+// Expands the root breadth first until there is enough independent work to keep every thread busy.
+std::vector<FrontierNode> BuildFrontier(Search &search, int threshold, std::size_t wanted) {
+  std::vector<FrontierNode> frontier{FrontierNode{InitialState(search.board), {}}};
+  for (int depth = 0; depth < threshold && frontier.size() < wanted; depth++) {
+    std::vector<FrontierNode> next;
+    for (const FrontierNode &node : frontier) {
+      if (search.IsGoal(node.state, depth)) {
+        search.RecordSolution(node.moves);
+        return {};
+      }
+      for (int i = 0; i < 4; i++) {
+        FrontierNode child;
+        child.moves = node.moves;
+        child.moves.push_back(static_cast<Direction>(i));
+        if (ApplyMove(search.board, node.state, static_cast<Direction>(i), child.state) &&
+            depth + 1 + search.Heuristic(child.state) <= threshold) {
+          next.push_back(std::move(child));
+        }
+      }
+    }
+    search.nodes += frontier.size();
+    frontier = std::move(next);
+  }
+  return frontier;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  int width = 8;
+  int height = 8;
+  int targetFood = 5;
+  bool targetFoodGiven = false;
+  int surviveMoves = 0;
+  int minFood = 0;
+  std::uint64_t seed = 1;
+  std::uint64_t gameId = 0;
+  int threads = std::max(1u, std::thread::hardware_concurrency());
+  std::size_t tableMegabytes = 256;
+  int maxMoves = 200;
+
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--width") == 0 && i + 1 < argc) {
+      width = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--height") == 0 && i + 1 < argc) {
+      height = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--target-food") == 0 && i + 1 < argc) {
+      targetFood = std::atoi(argv[++i]);
+      targetFoodGiven = true;
+    } else if (std::strcmp(argv[i], "--survive") == 0 && i + 1 < argc) {
+      surviveMoves = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--min-food") == 0 && i + 1 < argc) {
+      minFood = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = std::strtoull(argv[++i], nullptr, 10);
+    } else if (std::strcmp(argv[i], "--game-id") == 0 && i + 1 < argc) {
+      gameId = std::strtoull(argv[++i], nullptr, 10);
+    } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      threads = std::max(1, std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "--tt-mb") == 0 && i + 1 < argc) {
+      tableMegabytes = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--max-moves") == 0 && i + 1 < argc) {
+      maxMoves = std::atoi(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--width N] [--height N] [--target-food N | --survive N --min-food K] [--seed N] [--game-id N]"
+                   " [--threads N] [--tt-mb N] [--max-moves N]\n";
+      return 2;
+    }
+  }
+  if (width < 1 || height < 1 || width > 16 || height > 16) {
+    std::cerr << "Boards are limited to 16x16.\n";
+    return 2;
+  }
+  // Any short walk survives on an empty board, so survival also has to eat a minimum number of foods.
+  if (surviveMoves > 0) {
+    if (targetFoodGiven) {
+      std::cerr << "--target-food and --survive cannot be combined; use --min-food with --survive.\n";
+      return 2;
+    }
+    if (minFood < 1) {
+      std::cerr << "--survive needs --min-food K with K of at least 1.\n";
+      return 2;
+    }
+    targetFood = minFood;
+  } else if (minFood > 0) {
+    std::cerr << "--min-food only applies with --survive.\n";
+    return 2;
+  }
+  if (targetFood < 1 || targetFood >= width * height) {
+    std::cerr << "The food target must be between 1 and the number of cells minus one.\n";
+    return 2;
+  }
+  // Every worker keeps one search frame per move of depth, so the depth is capped to keep that memory bounded.
+  if (maxMoves < 1 || maxMoves > kMaxDepth || surviveMoves < 0 || surviveMoves > kMaxDepth) {
+    std::cerr << "--max-moves and --survive must be between 1 and " << kMaxDepth << ".\n";
+    return 2;
+  }
+
+  Board board{width, height, Bitboard{}, CounterRng(seed, gameId)};
+  for (int cell = 0; cell < width * height; cell++) {
+    board.valid.Set(cell);
+  }
+  bool survive = surviveMoves > 0;
+  Search search(board, targetFood, surviveMoves, tableMegabytes);
+
+  const int maxDepth = std::max(maxMoves, surviveMoves);
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.push_back(std::make_unique<Worker>(search, t, maxDepth));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  int threshold = survive ? surviveMoves : search.Heuristic(InitialState(board));
+  for (; threshold <= maxDepth && !search.found; threshold++) {
+    std::vector<FrontierNode> frontier = BuildFrontier(search, threshold, static_cast<std::size_t>(threads) * 16);
+    std::atomic<std::size_t> nextNode{0};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+      pool.emplace_back([&search, &frontier, &nextNode, &workers, threshold, t]() {
+        for (std::size_t i = nextNode++; i < frontier.size() && !search.found; i = nextNode++) {
+          workers[t]->Run(frontier[i], threshold);
+        }
+      });
+    }
+    for (std::thread &thread : pool) {
+      thread.join();
+    }
+    // Survival has a single fixed depth to try.
+    if (survive) {
+      break;
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "board " << width << "x" << height << " seed " << seed << " game " << gameId << "\n";
+  if (search.found) {
+    std::cout << (survive ? "surviving sequence" : "optimal sequence") << " (" << search.solution.size()
+              << " moves): ";
+    State state = InitialState(board);
+    State next;
+    for (Direction direction : search.solution) {
+      std::cout << kMoveNames[direction];
+      ApplyMove(board, state, direction, next);
+      state = next;
+    }
+    std::cout << "\n";
+    if (survive) {
+      std::cout << "foods eaten " << static_cast<int>(state.eaten) << " (at least " << minFood << " needed)\n";
+    }
+  } else if (survive) {
+    std::cout << "no sequence survives " << surviveMoves << " moves eating " << minFood << " foods\n";
+  } else {
+    std::cout << "no solution within " << maxMoves << " moves\n";
+  }
+
+  std::uint64_t nodes = search.nodes;
+  std::cout << std::fixed << std::setprecision(2) << "nodes " << nodes << " in " << seconds << "s ("
+            << nodes / std::max(seconds, 1e-9) / 1e6 << " M nodes/s, " << threads << " threads)\n";
+  std::cout << std::setprecision(1) << "memory: table " << search.table.Bytes() / (1024.0 * 1024) << " MB, search stacks "
+            << threads * workers[0]->StackBytes() / (1024.0 * 1024) << " MB, " << sizeof(State) << " bytes per position\n";
+  return search.found ? 0 : 1;
+}